@@ -25,7 +25,7 @@
 
 
 #ifdef ASCII_8X16_System
-static unsigned char const AsciiLib[95][16] = {
+static unsigned char const AsciiLib[ASCII_LAST - ASCII_FIRST + 1][ASCII_HEIGHT] = {
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
 
 {0x00,0x00,0x00,0x18,0x3C,0x3C,0x3C,0x18,0x18,0x00,0x18,0x18,0x00,0x00,0x00,0x00},/*"!",1*/
@@ -221,16 +221,42 @@ static unsigned char const AsciiLib[95][16] = {
 
 
 
+/*******************************************************************************
+* Function Name  : GetASCIIGlyph
+* Description    : Glyph of a character, read in place from the table
+* Input          : - ASCII: character code
+* Output         : None
+* Return         : ASCII_HEIGHT rows of ASCII_WIDTH bits, MSB on the left,
+*                  or NULL for codes the table does not hold
+* Attention       : None
+*******************************************************************************/
+const unsigned char *GetASCIIGlyph(unsigned char ASCII)
+{
+  if( ASCII < ASCII_FIRST || ASCII > ASCII_LAST )
+  {
+    return NULL;
+  }
+  return AsciiLib[(ASCII - ASCII_FIRST)];
+}
+
 /*******************************************************************************
 * Function Name  : GetASCIICode
 * Description    : ASCII
 * Input          : - ASCII: 
-* Output         : - *pBuffer:
+* Output         : - *pBuffer: the glyph, blank for codes the table does
+*                  not hold
 * Return         : None
 * Attention       : None
 *******************************************************************************/
 void GetASCIICode(unsigned char* pBuffer,unsigned char ASCII)
 {  
-  memcpy(pBuffer,AsciiLib[(ASCII - 32)] ,16);
+  const unsigned char *glyph = GetASCIIGlyph(ASCII);
+
+  if( glyph == NULL )
+  {
+    memset(pBuffer, 0, ASCII_HEIGHT);
+    return;
+  }
+  memcpy(pBuffer,glyph,ASCII_HEIGHT);
 }
 
@@ -30,8 +30,14 @@
 /* Private define ------------------------------------------------------------*/
 #define  ASCII_8X16_System
 
+#define  ASCII_WIDTH   8
+#define  ASCII_HEIGHT  16
+#define  ASCII_FIRST   32   /* ' ' */
+#define  ASCII_LAST    126  /* '~' */
+
 
 /* Private function prototypes -----------------------------------------------*/
+const unsigned char *GetASCIIGlyph(unsigned char ASCII);
 void GetASCIICode(unsigned char* pBuffer,unsigned char ASCII);
 
 #endif 
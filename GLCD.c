@@ -26,6 +26,55 @@
 //-----------------------------------------------------------------------------
 // Private variables 
 static uint8_t LCD_Code;
+static uint8_t LCD_WindowActive; // GRAM window is narrower than the screen
+static uint8_t LCD_BusDir;       // shadow of the P2.0..P2.7 / 74HC245 direction
+
+// Model of the controller's GRAM address counter, in panel coordinates
+static uint16_t LCD_EntryMode = 0x0030; // ID1/ID0/AM bits set by every init sequence
+static uint16_t LCD_EntryReg;    // other bits of the entry mode register
+static uint8_t LCD_EntryKnown;   // LCD_EntryReg read back since the last init
+static uint8_t LCD_Rotation;     // screen orientation in quarter turns
+static uint16_t LCD_Width = MAX_X, LCD_Height = MAX_Y; // screen size in that orientation
+static uint16_t LCD_WinX0, LCD_WinY0, LCD_WinX1, LCD_WinY1;
+static uint16_t LCD_CurX, LCD_CurY;
+static uint8_t LCD_CurValid;     // counter is known and the index is at 0x22
+static uint8_t LCD_ScrollOn;     // scrolling enabled since the last init
+static uint8_t LCD_TextMode;     // LCD_TEXT_OPAQUE or LCD_TEXT_TRANSPARENT
+static const uint8_t *LCD_Font;  // font of LCD_SetFont, NULL for the AsciiLib one
+
+// GRAM lines held by the partial images; LCD_Clear and other full-screen
+// writers leave them alone (Lines 0: image unused)
+static uint16_t LCD_PartialStart[ LCD_PARTIAL_IMAGES ];
+static uint16_t LCD_PartialLines[ LCD_PARTIAL_IMAGES ];
+static uint16_t LCD_PartialOn;   // PTDE bits of R07h
+
+// Clip rectangle stack, screen coordinates, x1/y1 exclusive; level 0 is the
+// whole screen and is never popped
+typedef struct
+{
+  int16_t x0, y0, x1, y1;
+} LCD_ClipRect;
+
+static LCD_ClipRect LCD_ClipStack[ LCD_CLIP_DEPTH ] = { { 0, 0, MAX_X, MAX_Y } };
+static uint8_t LCD_ClipLevel;
+#define LCD_CLIP  ( LCD_ClipStack[ LCD_ClipLevel ] )
+
+// Blend table of one foreground/background pair: the color of each 4-bit
+// coverage level of anti-aliased glyphs
+typedef struct
+{
+  uint16_t fg, bg;
+  uint16_t lut[16];
+} LCD_BlendTable;
+
+static LCD_BlendTable LCD_BlendCache[ LCD_BLEND_CACHE ];
+static uint8_t LCD_BlendOrder[ LCD_BLEND_CACHE ]; // cache entries, most recently used first
+static uint8_t LCD_BlendUsed;
+
+// Pixels read back by LCD_CopyRect and LCD_ReadScreen before being written
+// out again, and source rows decoded by the scaled blits; kept static, the
+// startup stack is only 512 bytes
+static uint16_t LCD_CopyBuffer[ LCD_COPY_PIXELS ];
 
 //-----------------------------------------------------------------------------
 // Private define 
@@ -45,6 +94,100 @@ static uint8_t LCD_Code;
 #define  LGDP4535  13 // 0x4535 
 #define  SSD2119    14 // 3.5 LCD 0x9919
 
+// Entry mode bits, same position in ILI932x R03h and SSD1289 R11h
+#define  ENTRY_AM   (1<<3)  // 1: address counter moves vertically first
+#define  ENTRY_ID0  (1<<4)  // 1: horizontal increment, 0: decrement
+#define  ENTRY_ID1  (1<<5)  // 1: vertical increment, 0: decrement
+#define  ENTRY_MASK ( ENTRY_AM | ENTRY_ID0 | ENTRY_ID1 )
+
+// Panel size; the screen is this size at 0 and 180 degrees
+#define  LCD_PANEL_X  240
+#define  LCD_PANEL_Y  320
+
+// Order in which a write session streams its rectangle
+#define  LCD_SCAN_ROWS     0
+#define  LCD_SCAN_COLUMNS  1
+
+
+//-----------------------------------------------------------------------------
+// Controller backend, chosen once at init from the DeviceCode probe; all
+// coordinates passed to it are panel coordinates (orientation applied)
+typedef struct
+{
+  void     (*SetCursor)(uint16_t Xpos, uint16_t Ypos);
+  void     (*SetWindow)(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+  void     (*BeginGRAMWrite)(void);
+  void     (*ReadPixels)(uint16_t *pixels, uint32_t count);
+  uint8_t  (*SetScroll)(uint16_t Line);
+  uint8_t  (*SetPartial)(uint8_t Image, uint16_t Position, uint16_t Start, uint16_t Lines);
+  uint8_t  (*SetEntry)(uint16_t Mode);
+} LCD_DriverOps;
+
+// Define LCD_FIXED_CONTROLLER as one of the codes above (e.g. ILI9325) to
+// build a single-controller driver: the backend is then called directly,
+// with no table and no per-pixel indirection
+#if !defined( LCD_FIXED_CONTROLLER )
+  #define LCD_OP(op)  LCD_Ops->op
+#elif ( LCD_FIXED_CONTROLLER == SSD1289 ) || ( LCD_FIXED_CONTROLLER == SSD1298 )
+  #define LCD_OP_SetCursor       SSD1289_SetCursor
+  #define LCD_OP_SetWindow       SSD1289_SetWindow
+  #define LCD_OP_ReadPixels      LCD_ReadPixelsRGB
+  #define LCD_OP_SetScroll       SSD1289_SetScroll
+  #define LCD_OP_SetEntry        SSD1289_SetEntry
+  #define LCD_OP_SetPartial      LCD_NoPartial
+#elif ( LCD_FIXED_CONTROLLER == SSD2119 )
+  #define LCD_OP_SetCursor       SSD1289_SetCursor
+  #define LCD_OP_SetWindow       SSD2119_SetWindow
+  #define LCD_OP_ReadPixels      LCD_ReadPixelsBGR
+  #define LCD_OP_SetScroll       SSD1289_SetScroll
+  #define LCD_OP_SetEntry        SSD1289_SetEntry
+  #define LCD_OP_SetPartial      LCD_NoPartial
+#elif ( LCD_FIXED_CONTROLLER == HX8346A )
+  #define LCD_OP_SetCursor       HX8347_SetCursor
+  #define LCD_OP_SetWindow       HX8347_SetWindow
+  #define LCD_OP_ReadPixels      LCD_ReadPixelsBGR
+  #define LCD_OP_SetScroll       LCD_NoScroll
+  #define LCD_OP_SetEntry        LCD_NoEntry
+  #define LCD_OP_SetPartial      LCD_NoPartial
+#elif ( LCD_FIXED_CONTROLLER == HX8347A ) || ( LCD_FIXED_CONTROLLER == HX8347D )
+  #define LCD_OP_SetCursor       HX8347_SetCursor
+  #define LCD_OP_SetWindow       HX8347_SetWindow
+  #define LCD_OP_ReadPixels      HX8347_ReadPixels
+  #define LCD_OP_SetScroll       LCD_NoScroll
+  #define LCD_OP_SetEntry        LCD_NoEntry
+  #define LCD_OP_SetPartial      LCD_NoPartial
+#elif ( LCD_FIXED_CONTROLLER == ST7781 ) || ( LCD_FIXED_CONTROLLER == LGDP4531 ) || \
+      ( LCD_FIXED_CONTROLLER == LGDP4535 )
+  #define LCD_OP_SetCursor       ILI932x_SetCursor
+  #define LCD_OP_SetWindow       ILI932x_SetWindow
+  #define LCD_OP_ReadPixels      LCD_ReadPixelsRGB
+  #define LCD_OP_SetScroll       ILI932x_SetScroll
+  #define LCD_OP_SetEntry        ILI932x_SetEntry
+  #define LCD_OP_SetPartial      ILI932x_SetPartial
+#else // ILI9320 ILI9325 ILI9328 ILI9331 SPFD5408B R61505U
+  #define LCD_OP_SetCursor       ILI932x_SetCursor
+  #define LCD_OP_SetWindow       ILI932x_SetWindow
+  #define LCD_OP_ReadPixels      LCD_ReadPixelsBGR
+  #define LCD_OP_SetScroll       ILI932x_SetScroll
+  #define LCD_OP_SetEntry        ILI932x_SetEntry
+  #define LCD_OP_SetPartial      ILI932x_SetPartial
+#endif
+#if defined( LCD_FIXED_CONTROLLER )
+  #define LCD_OP_BeginGRAMWrite  LCD_BeginGRAMWrite
+  #define LCD_OP(op)  LCD_OP_##op
+#endif
+
+#if !defined( LCD_FIXED_CONTROLLER )
+static const LCD_DriverOps *LCD_Ops;
+#endif
+
+
+#define  LCD_BUS_IN   0
+#define  LCD_BUS_OUT  1
+
+// LCD_CopyRect moves at least one whole screen line at a time
+typedef char LCD_CopyBufferCheck[ ( LCD_COPY_PIXELS >= LCD_PANEL_Y ) ? 1 : -1 ];
+
 
 //-----------------------------------------------------------------------------
 // Function Name  : Lcd_Configuration
@@ -60,19 +203,33 @@ static void LCD_Configuration(void)
 }
 
 
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BusOutput
+// Description    : Turns the data bus around to MCU->LCD; the direction is
+//                  shadowed, so FIODIR/DIR/EN are only touched after a read.
+static __attribute__((always_inline)) void LCD_BusOutput (void) 
+{
+  if( LCD_BusDir != LCD_BUS_OUT )
+  {
+    LPC_GPIO2->FIODIR0 = 0xFF;      // P2.0...P2.7 Output 
+    LCD_DIR(1)                        // Interface A->B 
+    LCD_EN(0)                         // Enable 2A->2B 
+    LCD_BusDir = LCD_BUS_OUT;
+  }
+}
+
+
 //-----------------------------------------------------------------------------
 // Function Name  : LCD_Send
 // Description    : 
 // Input          : - byte: byte to be sent
 static __attribute__((always_inline)) void LCD_Send (uint16_t byte) 
 {
-  LPC_GPIO2->FIODIR |= 0xFF;       // P2.0...P2.7 Output 
-  LCD_DIR(1)                        // Interface A->B 
-  LCD_EN(0)                         // Enable 2A->2B 
-  LPC_GPIO2->FIOPIN = byte;         // Write D0..D7 
+  LCD_BusOutput();
+  LPC_GPIO2->FIOPIN0 = byte;        // Write D0..D7 
   LCD_LE(1)                         
   LCD_LE(0)                         // latch D0..D7  
-  LPC_GPIO2->FIOPIN = byte >> 8;   // Write D8..D15 
+  LPC_GPIO2->FIOPIN0 = byte >> 8;   // Write D8..D15 
 }
 
 
@@ -94,7 +251,11 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 {
   uint16_t value;
   
-  LPC_GPIO2->FIODIR &= ~(0xFF);               // P2.0...P2.7 Input 
+  if( LCD_BusDir != LCD_BUS_IN )
+  {
+    LPC_GPIO2->FIODIR0 = 0x00;                // P2.0...P2.7 Input 
+    LCD_BusDir = LCD_BUS_IN;
+  }
   LCD_DIR(0);                                  // Interface B->A 
   LCD_EN(0);                                 // Enable 2B->2A 
   wait_delay(30);                             // delay some times 
@@ -113,9 +274,9 @@ static __attribute__((always_inline)) uint16_t LCD_Read (void)
 // Input          : - index:
 static __attribute__((always_inline)) void LCD_WriteIndex(uint16_t index)
 {
+  LCD_CurValid = 0;
   LCD_CS(0);
   LCD_RS(0);
-  LCD_RD(1);
   LCD_Send( index ); 
   wait_delay(25);  
   LCD_WR(0);  
@@ -141,6 +302,27 @@ static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 }
 
 
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_WriteStream
+// Description    : Writes one data word inside an open write session. CS and
+//                  RS are already asserted and FIO0MASK exposes only LE and
+//                  WR, so a single FIOPIN store drops both: the latch closes
+//                  on D0..D7 while WR falls, and the LCD samples on the WR
+//                  rising edge once D8..D15 are on the bus.
+//                  Five stores a pixel; tests/host/test_stream holds every
+//                  streaming primitive to that.
+// Input          : - data: 
+static __attribute__((always_inline)) void LCD_WriteStream(uint16_t data)
+{
+  LPC_GPIO2->FIOPIN0 = data;        // Write D0..D7 
+  LPC_GPIO0->FIOSET = PIN_LE;
+  LPC_GPIO0->FIOPIN = 0;            // LE and WR low 
+  LPC_GPIO2->FIOPIN0 = data >> 8;   // Write D8..D15 
+  wait_delay(1);
+  LPC_GPIO0->FIOSET = PIN_WR;
+}
+
+
 //-----------------------------------------------------------------------------
 // Function Name  : LCD_ReadData
 static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
@@ -159,6 +341,30 @@ static __attribute__((always_inline)) uint16_t LCD_ReadData(void)
 }
 
 
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ReadStream
+// Description    : Reads one data word inside an open read session (see
+//                  LCD_BeginRead): the bus already points from the LCD to
+//                  the CPU and CS/RS are asserted, so only RD and the byte
+//                  select move. The first wait covers the controller's read
+//                  access time, the second only the 74HC245 switching.
+// Return         : data word, D15..D0
+static __attribute__((always_inline)) uint16_t LCD_ReadStream(void)
+{
+  uint16_t value;
+
+  LCD_RD(0);
+  LCD_EN(0);                                  // D8..D15 
+  wait_delay(LCD_READ_ACCESS_DELAY);
+  value = LPC_GPIO2->FIOPIN0;
+  LCD_EN(1);                                  // D0..D7 
+  wait_delay(1);
+  value = (value << 8) | LPC_GPIO2->FIOPIN0;
+  LCD_RD(1);
+  return value;
+}
+
+
 //-----------------------------------------------------------------------------
 // Function Name  : LCD_WriteReg
 // Description    : Writes to the selected LCD register.
@@ -190,1184 +396,3038 @@ static __attribute__((always_inline)) uint16_t LCD_ReadReg(uint16_t LCD_Reg)
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_SetCursor
-// Description    : Sets the cursor position.
-// Input          : - Xpos: specifies the X position.
-//                  - Ypos: specifies the Y position. 
-static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
+// Function Name  : ILI932x_SetCursor
+// Description    : Cursor for 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505
+//                  0x0505 0x7783 0x4531 0x4535 (R20h/R21h)
+static __attribute__((unused)) void ILI932x_SetCursor(uint16_t Xpos,uint16_t Ypos)
 {
-  #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
-    uint16_t temp = Xpos;
-    Xpos = Ypos;
-    Ypos = ( MAX_X - 1 ) - temp;  
-  #elif  ( DISP_ORIENTATION == 0 ) || ( DISP_ORIENTATION == 180 )  
-  #endif
+  LCD_WriteReg(0x0020, Xpos );     
+  LCD_WriteReg(0x0021, Ypos );     
+}
 
-  switch( LCD_Code )
+
+//-----------------------------------------------------------------------------
+// Function Name  : ILI932x_SetWindow
+// Description    : Window R50h..R53h, then the cursor on its first pixel
+static __attribute__((unused)) void ILI932x_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  LCD_WriteReg(0x0050, x0 );
+  LCD_WriteReg(0x0051, x1 );
+  LCD_WriteReg(0x0052, y0 );
+  LCD_WriteReg(0x0053, y1 );
+  LCD_WriteReg(0x0020, x0 );
+  LCD_WriteReg(0x0021, y0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : SSD1289_SetCursor
+// Description    : Cursor for 0x8989 0x8999 0x9919 (R4Eh/R4Fh)
+static __attribute__((unused)) void SSD1289_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+  LCD_WriteReg(0x004e, Xpos );      
+  LCD_WriteReg(0x004f, Ypos );          
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : SSD1289_SetWindow
+// Description    : Window R44h (HEA:HSA), R45h/R46h, then the cursor
+static __attribute__((unused)) void SSD1289_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  LCD_WriteReg(0x0044, ( x1 << 8 ) | x0 );
+  LCD_WriteReg(0x0045, y0 );
+  LCD_WriteReg(0x0046, y1 );
+  LCD_WriteReg(0x004e, x0 );
+  LCD_WriteReg(0x004f, y0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : SSD2119_SetWindow
+// Description    : Window R44h (VEA:VSA), R45h/R46h, then the cursor; the
+//                  SSD2119 swaps the axes of the SSD1289 window registers
+static __attribute__((unused)) void SSD2119_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  LCD_WriteReg(0x0044, ( y1 << 8 ) | y0 );
+  LCD_WriteReg(0x0045, x0 );
+  LCD_WriteReg(0x0046, x1 );
+  LCD_WriteReg(0x004e, x0 );
+  LCD_WriteReg(0x004f, y0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : HX8347_SetCursor
+// Description    : Cursor for 0x0046 0x0047; the start address doubles as
+//                  the window start on these controllers
+static __attribute__((unused)) void HX8347_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+  LCD_WriteReg(0x02, Xpos>>8 );                                                  
+  LCD_WriteReg(0x03, Xpos );  
+  LCD_WriteReg(0x06, Ypos>>8 );                           
+  LCD_WriteReg(0x07, Ypos );    
+  LCD_WinX0 = Xpos;
+  LCD_WinY0 = Ypos;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : HX8347_SetWindow
+// Description    : Column and row start/end R02h..R09h
+static __attribute__((unused)) void HX8347_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  LCD_WriteReg(0x02, x0>>8 );
+  LCD_WriteReg(0x03, x0 );
+  LCD_WriteReg(0x04, x1>>8 );
+  LCD_WriteReg(0x05, x1 );
+  LCD_WriteReg(0x06, y0>>8 );
+  LCD_WriteReg(0x07, y0 );
+  LCD_WriteReg(0x08, y1>>8 );
+  LCD_WriteReg(0x09, y1 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : ILI932x_SetScroll
+// Description    : Base image scroll: R6Ah (VL) with VLE set in R61h. The
+//                  other R61h bits (NDL, REV) differ between the init
+//                  sequences, so they are read back and kept, once.
+// Input          : - Line: GRAM line shown on the first panel line
+// Return         : 1
+static __attribute__((unused)) uint8_t ILI932x_SetScroll(uint16_t Line)
+{
+  if( !LCD_ScrollOn )
   {
-     default: // 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 
-       LCD_WriteReg(0x0020, Xpos );     
-       LCD_WriteReg(0x0021, Ypos );     
-       break; 
-     case SSD1298: // 0x8999       
-     case SSD1289: // 0x8989 
-       LCD_WriteReg(0x004e, Xpos );      
-       LCD_WriteReg(0x004f, Ypos );          
-       break;  
-     case HX8346A:   // 0x0046 
-     case HX8347A:   // 0x0047 
-     case HX8347D:   // 0x0047 
-       LCD_WriteReg(0x02, Xpos>>8 );                                                  
-       LCD_WriteReg(0x03, Xpos );  
-       LCD_WriteReg(0x06, Ypos>>8 );                           
-       LCD_WriteReg(0x07, Ypos );    
-       break;     
-     case SSD2119: // 3.5 LCD 0x9919
-       break; 
+    LCD_WriteReg(0x0061, LCD_ReadReg(0x0061) | 0x0002 );
+    LCD_ScrollOn = 1;
   }
+  LCD_WriteReg(0x006A, Line );
+  return 1;
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_Delay
-// Description    : Delay Time
-// Input          : - nCount: Delay Time
-static void delay_ms(uint16_t ms)    
-{ 
-  uint16_t i,j; 
-  for( i = 0; i < ms; i++ )
-  { 
-    for( j = 0; j < 1141; j++ );
-  }
-} 
+// Function Name  : SSD1289_SetScroll
+// Description    : First screen vertical scroll R41h; the first screen
+//                  spans all 320 lines as set by R48h/R49h at init
+// Input          : - Line: GRAM line shown on the first panel line
+// Return         : 1
+static __attribute__((unused)) uint8_t SSD1289_SetScroll(uint16_t Line)
+{
+  LCD_WriteReg(0x0041, Line );
+  return 1;
+}
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_Initialization
-// Description    : Initialize TFT Controller
-void LCD_Initialization(void)
+// Function Name  : LCD_NoScroll
+// Description    : Controllers whose scrolling is not supported here
+// Return         : 0
+static __attribute__((unused)) uint8_t LCD_NoScroll(uint16_t Line)
 {
-  uint16_t DeviceCode;
-  
-  LCD_Configuration();
-  delay_ms(100);
-  DeviceCode = LCD_ReadReg(0x0000);  
-
-  // Note: Here, I commented out what appeared, thru trial and error, to be
-  // unnecessary; needed to do this to get this whole thing linkable with
-  // the lite edition of uVision;
-  // if it does not work for you, uncomment out the "if" that works for you;
-  /*---
-  if( DeviceCode == 0x9325 || DeviceCode == 0x9328 )  
-  {
-    LCD_Code = ILI9325;
-    LCD_WriteReg(0x00e7,0x0010);      
-    LCD_WriteReg(0x0000,0x0001); // start internal osc
-    LCD_WriteReg(0x0001,0x0100);     
-    LCD_WriteReg(0x0002,0x0700); // power on sequence
-    LCD_WriteReg(0x0003,(1<<12)|(1<<5)|(1<<4)|(0<<3) ); // importance
-    LCD_WriteReg(0x0004,0x0000);                                   
-    LCD_WriteReg(0x0008,0x0207);             
-    LCD_WriteReg(0x0009,0x0000);         
-    LCD_WriteReg(0x000a,0x0000);   //display setting        
-    LCD_WriteReg(0x000c,0x0001);  //display setting        
-    LCD_WriteReg(0x000d,0x0000);               
-    LCD_WriteReg(0x000f,0x0000);
-    // Power On sequence
-    LCD_WriteReg(0x0010,0x0000);   
-    LCD_WriteReg(0x0011,0x0007);
-    LCD_WriteReg(0x0012,0x0000);                                                                 
-    LCD_WriteReg(0x0013,0x0000);                 
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0010,0x1590);   
-    LCD_WriteReg(0x0011,0x0227);
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0012,0x009c);                  
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0013,0x1900);   
-    LCD_WriteReg(0x0029,0x0023);
-    LCD_WriteReg(0x002b,0x000e);
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0020,0x0000);                                                            
-    LCD_WriteReg(0x0021,0x0000);           
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0030,0x0007); 
-    LCD_WriteReg(0x0031,0x0707);   
-    LCD_WriteReg(0x0032,0x0006);
-    LCD_WriteReg(0x0035,0x0704);
-    LCD_WriteReg(0x0036,0x1f04); 
-    LCD_WriteReg(0x0037,0x0004);
-    LCD_WriteReg(0x0038,0x0000);        
-    LCD_WriteReg(0x0039,0x0706);     
-    LCD_WriteReg(0x003c,0x0701);
-    LCD_WriteReg(0x003d,0x000f);
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0050,0x0000);        
-    LCD_WriteReg(0x0051,0x00ef);   
-    LCD_WriteReg(0x0052,0x0000);     
-    LCD_WriteReg(0x0053,0x013f);
-    LCD_WriteReg(0x0060,0xa700);        
-    LCD_WriteReg(0x0061,0x0001); 
-    LCD_WriteReg(0x006a,0x0000);
-    LCD_WriteReg(0x0080,0x0000);
-    LCD_WriteReg(0x0081,0x0000);
-    LCD_WriteReg(0x0082,0x0000);
-    LCD_WriteReg(0x0083,0x0000);
-    LCD_WriteReg(0x0084,0x0000);
-    LCD_WriteReg(0x0085,0x0000);
-      
-    LCD_WriteReg(0x0090,0x0010);     
-    LCD_WriteReg(0x0092,0x0000);  
-    LCD_WriteReg(0x0093,0x0003);
-    LCD_WriteReg(0x0095,0x0110);
-    LCD_WriteReg(0x0097,0x0000);        
-    LCD_WriteReg(0x0098,0x0000);  
-    //display on sequence    
-    LCD_WriteReg(0x0007,0x0133);
-    
-    LCD_WriteReg(0x0020,0x0000);                                                         
-    LCD_WriteReg(0x0021,0x0000);    
-  }
-  ---*/
-  /*---
-  if( DeviceCode == 0x9320 || DeviceCode == 0x9300 )
-  {
-    LCD_Code = ILI9320;
-    LCD_WriteReg(0x00,0x0000);
-    LCD_WriteReg(0x01,0x0100);  //Driver Output Contral
-    LCD_WriteReg(0x02,0x0700);  //LCD Driver Waveform Contral
-    LCD_WriteReg(0x03,0x1018);  //Entry Mode Set
-    
-    LCD_WriteReg(0x04,0x0000);  //Scalling Contral
-     LCD_WriteReg(0x08,0x0202);  //Display Contral
-    LCD_WriteReg(0x09,0x0000);  //Display Contral 3.(0x0000)
-    LCD_WriteReg(0x0a,0x0000);  //Frame Cycle Contal.(0x0000)
-    LCD_WriteReg(0x0c,(1<<0));  //Extern Display Interface Contral
-    LCD_WriteReg(0x0d,0x0000);  //Frame Maker Position
-    LCD_WriteReg(0x0f,0x0000);  //Extern Display Interface Contral 2.
-    
-    delay_ms(100);  //delay 100 ms    
-    LCD_WriteReg(0x07,0x0101);  //Display Contral
-    delay_ms(100);  //delay 100 ms    
-  
-    LCD_WriteReg(0x10,(1<<12)|(0<<8)|(1<<7)|(1<<6)|(0<<4));  //Power Control 1.(0x16b0)  
-    LCD_WriteReg(0x11,0x0007);                //Power Control 2
-    LCD_WriteReg(0x12,(1<<8)|(1<<4)|(0<<0));  //Power Control 3.(0x0138)  
-    LCD_WriteReg(0x13,0x0b00);                //Power Control 4
-    LCD_WriteReg(0x29,0x0000);                //Power Control 7
-    
-    LCD_WriteReg(0x2b,(1<<14)|(1<<4));
-      
-    LCD_WriteReg(0x50,0);       //Set X Start
-    LCD_WriteReg(0x51,239);      //Set X End
-    LCD_WriteReg(0x52,0);        //Set Y Start
-    LCD_WriteReg(0x53,319);      //Set Y End
-    
-    LCD_WriteReg(0x60,0x2700);  //Driver Output Control
-    LCD_WriteReg(0x61,0x0001);  //Driver Output Control
-    LCD_WriteReg(0x6a,0x0000);  //Vertical Srcoll Control
-    
-    LCD_WriteReg(0x80,0x0000);  //Display Position? Partial Display 1
-    LCD_WriteReg(0x81,0x0000);  //RAM Address Start? Partial Display 1
-    LCD_WriteReg(0x82,0x0000);  //RAM Address End-Partial Display 1
-    LCD_WriteReg(0x83,0x0000);  //Displsy Position? Partial Display 2
-    LCD_WriteReg(0x84,0x0000);  //RAM Address Start? Partial Display 2
-    LCD_WriteReg(0x85,0x0000);  //RAM Address End? Partial Display 2
-    
-    LCD_WriteReg(0x90,(0<<7)|(16<<0));  //Frame Cycle Contral.(0x0013)  
-    LCD_WriteReg(0x92,0x0000);  //Panel Interface Contral 2.(0x0000)
-    LCD_WriteReg(0x93,0x0001);  //Panel Interface Contral 3.
-    LCD_WriteReg(0x95,0x0110);  //Frame Cycle Contral.(0x0110)  
-    LCD_WriteReg(0x97,(0<<8));  
-    LCD_WriteReg(0x98,0x0000);  //Frame Cycle Contral
-  
-    LCD_WriteReg(0x07,0x0173);
-  }
-  ---*/
-  /*---
-  if( DeviceCode == 0x9331 )
-  {
-    LCD_Code = ILI9331;
-    LCD_WriteReg(0x00E7, 0x1014);
-    LCD_WriteReg(0x0001, 0x0100);   //set SS and SM bit
-    LCD_WriteReg(0x0002, 0x0200);   //set 1 line inversion
-    LCD_WriteReg(0x0003, 0x1030);   //set GRAM write direction and BGR=1
-    LCD_WriteReg(0x0008, 0x0202);   //set the back porch and front porch
-    LCD_WriteReg(0x0009, 0x0000);   //set non-display area refresh cycle ISC[3:0]
-    LCD_WriteReg(0x000A, 0x0000);   //FMARK function
-    LCD_WriteReg(0x000C, 0x0000);   //RGB interface setting
-    LCD_WriteReg(0x000D, 0x0000);   //Frame marker Position
-    LCD_WriteReg(0x000F, 0x0000);   //RGB interface polarity
-    //Power On sequence
-    LCD_WriteReg(0x0010, 0x0000);   //SAP, BT[3:0], AP, DSTB, SLP, STB  
-    LCD_WriteReg(0x0011, 0x0007);   //DC1[2:0], DC0[2:0], VC[2:0]
-    LCD_WriteReg(0x0012, 0x0000);   //VREG1OUT voltage  
-    LCD_WriteReg(0x0013, 0x0000);   //VDV[4:0] for VCOM amplitude
-    delay_ms(200);  //delay 200 ms    
-    LCD_WriteReg(0x0010, 0x1690);   //SAP, BT[3:0], AP, DSTB, SLP, STB  
-    LCD_WriteReg(0x0011, 0x0227);   //DC1[2:0], DC0[2:0], VC[2:0]
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0012, 0x000C);   //Internal reference voltage= Vci  
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0013, 0x0800);   //Set VDV[4:0] for VCOM amplitude
-    LCD_WriteReg(0x0029, 0x0011);   //Set VCM[5:0] for VCOMH
-    LCD_WriteReg(0x002B, 0x000B);   //Set Frame Rate
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0020, 0x0000);   //GRAM horizontal Address
-    LCD_WriteReg(0x0021, 0x0000);   //GRAM Vertical Address
-    //Adjust the Gamma Curve
-    LCD_WriteReg(0x0030, 0x0000);
-    LCD_WriteReg(0x0031, 0x0106);
-    LCD_WriteReg(0x0032, 0x0000);
-    LCD_WriteReg(0x0035, 0x0204);
-    LCD_WriteReg(0x0036, 0x160A);
-    LCD_WriteReg(0x0037, 0x0707);
-    LCD_WriteReg(0x0038, 0x0106);
-    LCD_WriteReg(0x0039, 0x0707);
-    LCD_WriteReg(0x003C, 0x0402);
-    LCD_WriteReg(0x003D, 0x0C0F);
-    //Set GRAM area
-    LCD_WriteReg(0x0050, 0x0000);   //Horizontal GRAM Start Address
-    LCD_WriteReg(0x0051, 0x00EF);   //Horizontal GRAM End Address
-    LCD_WriteReg(0x0052, 0x0000);   //Vertical GRAM Start Address
-    LCD_WriteReg(0x0053, 0x013F);   //Vertical GRAM Start Address
-    LCD_WriteReg(0x0060, 0x2700);   //Gate Scan Line
-    LCD_WriteReg(0x0061, 0x0001);   // NDL,VLE, REV
-    LCD_WriteReg(0x006A, 0x0000);   //set scrolling line
-    //Partial Display Control
-    LCD_WriteReg(0x0080, 0x0000);
-    LCD_WriteReg(0x0081, 0x0000);
-    LCD_WriteReg(0x0082, 0x0000);
-    LCD_WriteReg(0x0083, 0x0000);
-    LCD_WriteReg(0x0084, 0x0000);
-    LCD_WriteReg(0x0085, 0x0000);
-    //Panel Control
-    LCD_WriteReg(0x0090, 0x0010);
-    LCD_WriteReg(0x0092, 0x0600);
-    LCD_WriteReg(0x0007,0x0021);    
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0007,0x0061);
-    delay_ms(50);  //delay 50 ms    
-    LCD_WriteReg(0x0007,0x0133);    //262K color and display ON
-  }
-  ---*/
-  /*---
-  if( DeviceCode == 0x9919 )
-  {
-    LCD_Code = SSD2119;
-    //POWER ON &RESET DISPLAY OFF
-    LCD_WriteReg(0x28,0x0006);
-    LCD_WriteReg(0x00,0x0001);    
-    LCD_WriteReg(0x10,0x0000);    
-    LCD_WriteReg(0x01,0x72ef);
-    LCD_WriteReg(0x02,0x0600);
-    LCD_WriteReg(0x03,0x6a38);  
-    LCD_WriteReg(0x11,0x6874);
-    LCD_WriteReg(0x0f,0x0000);    //RAM WRITE DATA MASK
-    LCD_WriteReg(0x0b,0x5308);    //RAM WRITE DATA MASK
-    LCD_WriteReg(0x0c,0x0003);
-    LCD_WriteReg(0x0d,0x000a);
-    LCD_WriteReg(0x0e,0x2e00);  
-    LCD_WriteReg(0x1e,0x00be);
-    LCD_WriteReg(0x25,0x8000);
-    LCD_WriteReg(0x26,0x7800);
-    LCD_WriteReg(0x27,0x0078);
-    LCD_WriteReg(0x4e,0x0000);
-    LCD_WriteReg(0x4f,0x0000);
-    LCD_WriteReg(0x12,0x08d9);
-    //Adjust the Gamma Curve
-    LCD_WriteReg(0x30,0x0000);
-    LCD_WriteReg(0x31,0x0104);   
-    LCD_WriteReg(0x32,0x0100);  
-    LCD_WriteReg(0x33,0x0305);  
-    LCD_WriteReg(0x34,0x0505);   
-    LCD_WriteReg(0x35,0x0305);  
-    LCD_WriteReg(0x36,0x0707);  
-    LCD_WriteReg(0x37,0x0300);  
-    LCD_WriteReg(0x3a,0x1200);  
-    LCD_WriteReg(0x3b,0x0800);     
-    LCD_WriteReg(0x07,0x0033);
-  }
-  ---*/
-  /*---
-  if( DeviceCode == 0x1505 || DeviceCode == 0x0505 )
-  {
-    LCD_Code = R61505U;
-    //initializing funciton   
-    LCD_WriteReg(0xe5,0x8000);  //Set the internal vcore voltage   
-    LCD_WriteReg(0x00,0x0001);  //start OSC   
-    LCD_WriteReg(0x2b,0x0010);  //Set the frame rate as 80 when the internal resistor is used for oscillator circuit   
-    LCD_WriteReg(0x01,0x0100);  //s720  to  s1 ; G1 to G320   
-    LCD_WriteReg(0x02,0x0700);  //set the line inversion   
-    LCD_WriteReg(0x03,0x1018);  //65536 colors    
-    LCD_WriteReg(0x04,0x0000);   
-    LCD_WriteReg(0x08,0x0202);  //specify the line number of front and back porch periods respectively   
-    LCD_WriteReg(0x09,0x0000);   
-    LCD_WriteReg(0x0a,0x0000);   
-    LCD_WriteReg(0x0c,0x0000);  //select  internal system clock  
-    LCD_WriteReg(0x0d,0x0000);   
-    LCD_WriteReg(0x0f,0x0000);    
-    LCD_WriteReg(0x50,0x0000);  //set windows adress   
-    LCD_WriteReg(0x51,0x00ef);   
-    LCD_WriteReg(0x52,0x0000);   
-    LCD_WriteReg(0x53,0x013f);   
-    LCD_WriteReg(0x60,0x2700);   
-    LCD_WriteReg(0x61,0x0001);   
-    LCD_WriteReg(0x6a,0x0000);   
-    LCD_WriteReg(0x80,0x0000);   
-    LCD_WriteReg(0x81,0x0000);   
-    LCD_WriteReg(0x82,0x0000);   
-    LCD_WriteReg(0x83,0x0000);   
-    LCD_WriteReg(0x84,0x0000);   
-    LCD_WriteReg(0x85,0x0000);   
-    LCD_WriteReg(0x90,0x0010);   
-    LCD_WriteReg(0x92,0x0000);   
-    LCD_WriteReg(0x93,0x0003);   
-    LCD_WriteReg(0x95,0x0110);   
-    LCD_WriteReg(0x97,0x0000);   
-    LCD_WriteReg(0x98,0x0000);    
-    //power setting function   
-    LCD_WriteReg(0x10,0x0000);   
-    LCD_WriteReg(0x11,0x0000);   
-    LCD_WriteReg(0x12,0x0000);   
-    LCD_WriteReg(0x13,0x0000);   
-    delay_ms(100);   
-    LCD_WriteReg(0x10,0x17b0);   
-    LCD_WriteReg(0x11,0x0004);   
-    delay_ms(50);   
-    LCD_WriteReg(0x12,0x013e);   
-    delay_ms(50);   
-    LCD_WriteReg(0x13,0x1f00);   
-    LCD_WriteReg(0x29,0x000f);   
-    delay_ms(50);   
-    LCD_WriteReg(0x20,0x0000);   
-    LCD_WriteReg(0x21,0x0000);   
-    
-    //initializing function    
-    LCD_WriteReg(0x30,0x0204);   
-    LCD_WriteReg(0x31,0x0001);   
-    LCD_WriteReg(0x32,0x0000);   
-    LCD_WriteReg(0x35,0x0206);   
-    LCD_WriteReg(0x36,0x0600);   
-    LCD_WriteReg(0x37,0x0500);   
-    LCD_WriteReg(0x38,0x0505);   
-    LCD_WriteReg(0x39,0x0407);   
-    LCD_WriteReg(0x3c,0x0500);   
-    LCD_WriteReg(0x3d,0x0503);   
-    
-    //display on  
-    LCD_WriteReg(0x07,0x0173);  
-  }  
-  ---*/
-  if( DeviceCode == 0x8989 )
-  {
-      LCD_Code = SSD1289;
-      LCD_WriteReg(0x0000,0x0001);    delay_ms(50); 
-      LCD_WriteReg(0x0003,0xA8A4);    delay_ms(50);   
-      LCD_WriteReg(0x000C,0x0000);    delay_ms(50);   
-      LCD_WriteReg(0x000D,0x080C);    delay_ms(50);   
-      LCD_WriteReg(0x000E,0x2B00);    delay_ms(50);   
-      LCD_WriteReg(0x001E,0x00B0);    delay_ms(50);   
-      LCD_WriteReg(0x0001,0x2B3F);    delay_ms(50);   //320*240 0x2B3F
-      LCD_WriteReg(0x0002,0x0600);    delay_ms(50);
-      LCD_WriteReg(0x0010,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0011,0x6070);    delay_ms(50);   //0x6070
-      LCD_WriteReg(0x0005,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0006,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0016,0xEF1C);    delay_ms(50);
-      LCD_WriteReg(0x0017,0x0003);    delay_ms(50);
-      LCD_WriteReg(0x0007,0x0133);    delay_ms(50);         
-      LCD_WriteReg(0x000B,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x000F,0x0000);    delay_ms(50);   
-      LCD_WriteReg(0x0041,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0042,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0048,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0049,0x013F);    delay_ms(50);
-      LCD_WriteReg(0x004A,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x004B,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0044,0xEF00);    delay_ms(50);
-      LCD_WriteReg(0x0045,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0046,0x013F);    delay_ms(50);
-      LCD_WriteReg(0x0030,0x0707);    delay_ms(50);
-      LCD_WriteReg(0x0031,0x0204);    delay_ms(50);
-      LCD_WriteReg(0x0032,0x0204);    delay_ms(50);
-      LCD_WriteReg(0x0033,0x0502);    delay_ms(50);
-      LCD_WriteReg(0x0034,0x0507);    delay_ms(50);
-      LCD_WriteReg(0x0035,0x0204);    delay_ms(50);
-      LCD_WriteReg(0x0036,0x0204);    delay_ms(50);
-      LCD_WriteReg(0x0037,0x0502);    delay_ms(50);
-      LCD_WriteReg(0x003A,0x0302);    delay_ms(50);
-      LCD_WriteReg(0x003B,0x0302);    delay_ms(50);
-      LCD_WriteReg(0x0023,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0024,0x0000);    delay_ms(50);
-      LCD_WriteReg(0x0025,0x8000);    delay_ms(50);
-      LCD_WriteReg(0x004f,0);     
-      LCD_WriteReg(0x004e,0);      
-  }
-  /*---
-  if( DeviceCode == 0x8999 )
-  {
-    LCD_Code = SSD1298;    
-    LCD_WriteReg(0x0028,0x0006);
-    LCD_WriteReg(0x0000,0x0001);
-    LCD_WriteReg(0x0003,0xaea4);    //power control 1---line frequency and VHG,VGL voltage
-    LCD_WriteReg(0x000c,0x0004);    //power control 2---VCIX2 output voltage
-    LCD_WriteReg(0x000d,0x000c);    //power control 3---Vlcd63 voltage
-    LCD_WriteReg(0x000e,0x2800);    //power control 4---VCOMA voltage VCOML=VCOMH*0.9475-VCOMA
-    LCD_WriteReg(0x001e,0x00b5);    //POWER CONTROL 5---VCOMH voltage   
-    LCD_WriteReg(0x0001,0x3b3f);     
-    LCD_WriteReg(0x0002,0x0600);
-    LCD_WriteReg(0x0010,0x0000);
-    LCD_WriteReg(0x0011,0x6830);
-    LCD_WriteReg(0x0005,0x0000);
-    LCD_WriteReg(0x0006,0x0000);
-    LCD_WriteReg(0x0016,0xef1c);  
-    LCD_WriteReg(0x0007,0x0033);    //Display control 1
-    //when GON=1 and DTE=0,all gate outputs become VGL
-    //when GON=1 and DTE=0,all gate outputs become VGH
-    //non-selected gate wires become VGL     
-    LCD_WriteReg(0x000b,0x0000);
-    LCD_WriteReg(0x000f,0x0000);
-    LCD_WriteReg(0x0041,0x0000);
-    LCD_WriteReg(0x0042,0x0000);
-    LCD_WriteReg(0x0048,0x0000);
-    LCD_WriteReg(0x0049,0x013f);
-    LCD_WriteReg(0x004a,0x0000);
-    LCD_WriteReg(0x004b,0x0000); 
-    LCD_WriteReg(0x0044,0xef00);  //Horizontal RAM start and end address
-    LCD_WriteReg(0x0045,0x0000);  //Vretical RAM start address
-    LCD_WriteReg(0x0046,0x013f);  //Vretical RAM end address 
-    LCD_WriteReg(0x004e,0x0000);  //set GDDRAM x address counter
-    LCD_WriteReg(0x004f,0x0000);  //set GDDRAM y address counter   
-    //y control
-    LCD_WriteReg(0x0030,0x0707);
-    LCD_WriteReg(0x0031,0x0202);
-    LCD_WriteReg(0x0032,0x0204);
-    LCD_WriteReg(0x0033,0x0502);
-    LCD_WriteReg(0x0034,0x0507);
-    LCD_WriteReg(0x0035,0x0204);
-    LCD_WriteReg(0x0036,0x0204);
-    LCD_WriteReg(0x0037,0x0502);
-    LCD_WriteReg(0x003a,0x0302);
-    LCD_WriteReg(0x003b,0x0302); 
-    LCD_WriteReg(0x0023,0x0000);
-    LCD_WriteReg(0x0024,0x0000);
-    LCD_WriteReg(0x0025,0x8000);
-    LCD_WriteReg(0x0026,0x7000);
-    LCD_WriteReg(0x0020,0xb0eb);
-    LCD_WriteReg(0x0027,0x007c);
-  }
-  if( DeviceCode == 0x5408 )
-  {
-    LCD_Code = SPFD5408B;
-    
-    LCD_WriteReg(0x0001,0x0100);    //Driver Output Contral Register 
-    LCD_WriteReg(0x0002,0x0700);    //LCD Driving Waveform Contral
-    LCD_WriteReg(0x0003,0x1030);    //Entry Mode
-    
-    LCD_WriteReg(0x0004,0x0000);    //Scalling Control register
-    LCD_WriteReg(0x0008,0x0207);    //Display Control 2
-    LCD_WriteReg(0x0009,0x0000);    //Display Control 3
-    LCD_WriteReg(0x000A,0x0000);    //Frame Cycle Control
-    LCD_WriteReg(0x000C,0x0000);    //External Display Interface Control 1
-    LCD_WriteReg(0x000D,0x0000);    //Frame Maker Position
-    LCD_WriteReg(0x000F,0x0000);    //External Display Interface Control 2
-    delay_ms(50);
-    LCD_WriteReg(0x0007,0x0101);    //Display Control
-    delay_ms(50);
-    LCD_WriteReg(0x0010,0x16B0);      //Power Control 1
-    LCD_WriteReg(0x0011,0x0001);      //Power Control 2
-    LCD_WriteReg(0x0017,0x0001);      //Power Control 3
-    LCD_WriteReg(0x0012,0x0138);      //Power Control 4
-    LCD_WriteReg(0x0013,0x0800);      //Power Control 5
-    LCD_WriteReg(0x0029,0x0009);    //NVM read data 2
-    LCD_WriteReg(0x002a,0x0009);    //NVM read data 3
-    LCD_WriteReg(0x00a4,0x0000);  
-    LCD_WriteReg(0x0050,0x0000);    
-    LCD_WriteReg(0x0051,0x00EF);   
-    LCD_WriteReg(0x0052,0x0000);    
-    LCD_WriteReg(0x0053,0x013F);  
-       
-    LCD_WriteReg(0x0060,0x2700);    //Driver Output Control
-              
-    LCD_WriteReg(0x0061,0x0003);    //Driver Output Control
-    LCD_WriteReg(0x006A,0x0000);    //Vertical Scroll Control
-    
-    LCD_WriteReg(0x0080,0x0000);    //Display Position C Partial Display 1
-    LCD_WriteReg(0x0081,0x0000);    //RAM Address Start C Partial Display 1
-    LCD_WriteReg(0x0082,0x0000);    //RAM address End - Partial Display 1
-    LCD_WriteReg(0x0083,0x0000);    //Display Position C Partial Display 2
-    LCD_WriteReg(0x0084,0x0000);    //RAM Address Start C Partial Display 2
-    LCD_WriteReg(0x0085,0x0000);    //RAM address End C Partail Display2
-    LCD_WriteReg(0x0090,0x0013);    //Frame Cycle Control
-    LCD_WriteReg(0x0092,0x0000);     //Panel Interface Control 2
-    LCD_WriteReg(0x0093,0x0003);    //Panel Interface control 3
-    LCD_WriteReg(0x0095,0x0110);    //Frame Cycle Control
-    LCD_WriteReg(0x0007,0x0173);
-  }
-  if( DeviceCode == 0x4531 )
-  {  
-    LCD_Code = LGDP4531;
-    //Setup display
-    LCD_WriteReg(0x00,0x0001);
-    LCD_WriteReg(0x10,0x0628);
-    LCD_WriteReg(0x12,0x0006);
-    LCD_WriteReg(0x13,0x0A32);
-    LCD_WriteReg(0x11,0x0040);
-    LCD_WriteReg(0x15,0x0050);
-    LCD_WriteReg(0x12,0x0016);
-    delay_ms(50);
-    LCD_WriteReg(0x10,0x5660);
-    delay_ms(50);
-    LCD_WriteReg(0x13,0x2A4E);
-    LCD_WriteReg(0x01,0x0100);
-    LCD_WriteReg(0x02,0x0300);  
-    LCD_WriteReg(0x03,0x1030);    
-    LCD_WriteReg(0x08,0x0202);
-    LCD_WriteReg(0x0A,0x0000);
-    LCD_WriteReg(0x30,0x0000);
-    LCD_WriteReg(0x31,0x0402);
-    LCD_WriteReg(0x32,0x0106);
-    LCD_WriteReg(0x33,0x0700);
-    LCD_WriteReg(0x34,0x0104);
-    LCD_WriteReg(0x35,0x0301);
-    LCD_WriteReg(0x36,0x0707);
-    LCD_WriteReg(0x37,0x0305);
-    LCD_WriteReg(0x38,0x0208);
-    LCD_WriteReg(0x39,0x0F0B);
-    delay_ms(50);
-    LCD_WriteReg(0x41,0x0002);
-    LCD_WriteReg(0x60,0x2700);
-    LCD_WriteReg(0x61,0x0001);
-    LCD_WriteReg(0x90,0x0119);
-    LCD_WriteReg(0x92,0x010A);
-    LCD_WriteReg(0x93,0x0004);
-    LCD_WriteReg(0xA0,0x0100);
-    delay_ms(50);
-    LCD_WriteReg(0x07,0x0133);
-    delay_ms(50);
-    LCD_WriteReg(0xA0,0x0000);
-  }
-  if( DeviceCode == 0x4535 )
-  {  
-    LCD_Code = LGDP4535;  
-    LCD_WriteReg(0x15, 0x0030);      //Set the internal vcore voltage                                              
-    LCD_WriteReg(0x9A, 0x0010);      //Start internal OSC
-    LCD_WriteReg(0x11, 0x0020);       //set SS and SM bit
-    LCD_WriteReg(0x10, 0x3428);       //set 1 line inversion
-    LCD_WriteReg(0x12, 0x0002);       //set GRAM write direction and BGR=1 
-    LCD_WriteReg(0x13, 0x1038);       //Resize register
-    delay_ms(40); 
-    LCD_WriteReg(0x12, 0x0012);       //set the back porch and front porch
-    delay_ms(40); 
-    LCD_WriteReg(0x10, 0x3420);       //set non-display area refresh cycle ISC[3:0]
-    LCD_WriteReg(0x13, 0x3045);       //FMARK function
-    delay_ms(70); 
-    LCD_WriteReg(0x30, 0x0000);      //RGB interface setting
-    LCD_WriteReg(0x31, 0x0402);       //Frame marker Position
-    LCD_WriteReg(0x32, 0x0307);      //RGB interface polarity
-    LCD_WriteReg(0x33, 0x0304);      //SAP, BT[3:0], AP, DSTB, SLP, STB
-    LCD_WriteReg(0x34, 0x0004);      //DC1[2:0], DC0[2:0], VC[2:0]
-    LCD_WriteReg(0x35, 0x0401);      //VREG1OUT voltage
-    LCD_WriteReg(0x36, 0x0707);      //VDV[4:0] for VCOM amplitude
-    LCD_WriteReg(0x37, 0x0305);      //SAP, BT[3:0], AP, DSTB, SLP, STB
-    LCD_WriteReg(0x38, 0x0610);      //DC1[2:0], DC0[2:0], VC[2:0]
-    LCD_WriteReg(0x39, 0x0610);      //VREG1OUT voltage
-    LCD_WriteReg(0x01, 0x0100);      //VDV[4:0] for VCOM amplitude
-    LCD_WriteReg(0x02, 0x0300);      //VCM[4:0] for VCOMH
-    LCD_WriteReg(0x03, 0x1030);      //GRAM horizontal Address
-    LCD_WriteReg(0x08, 0x0808);      //GRAM Vertical Address
-    LCD_WriteReg(0x0A, 0x0008);    
-    LCD_WriteReg(0x60, 0x2700);       //Gate Scan Line
-    LCD_WriteReg(0x61, 0x0001);       //NDL,VLE, REV
-    LCD_WriteReg(0x90, 0x013E);
-    LCD_WriteReg(0x92, 0x0100);
-    LCD_WriteReg(0x93, 0x0100);
-    LCD_WriteReg(0xA0, 0x3000);
-    LCD_WriteReg(0xA3, 0x0010);
-    LCD_WriteReg(0x07, 0x0001);
-    LCD_WriteReg(0x07, 0x0021);
-    LCD_WriteReg(0x07, 0x0023);
-    LCD_WriteReg(0x07, 0x0033);
-    LCD_WriteReg(0x07, 0x0133);
-  }          
-  else if( DeviceCode == 0x0047 )
-  {
-    LCD_Code = HX8347D;
-    //Start Initial Sequence
-    LCD_WriteReg(0xEA,0x00);                          
-    LCD_WriteReg(0xEB,0x20);                                                     
-    LCD_WriteReg(0xEC,0x0C);                                                   
-    LCD_WriteReg(0xED,0xC4);                                                    
-    LCD_WriteReg(0xE8,0x40);                                                     
-    LCD_WriteReg(0xE9,0x38);                                                    
-    LCD_WriteReg(0xF1,0x01);                                                    
-    LCD_WriteReg(0xF2,0x10);                                                    
-    LCD_WriteReg(0x27,0xA3);                                                    
-    //GAMMA SETTING
-    LCD_WriteReg(0x40,0x01);                           
-    LCD_WriteReg(0x41,0x00);                                                   
-    LCD_WriteReg(0x42,0x00);                                                   
-    LCD_WriteReg(0x43,0x10);                                                    
-    LCD_WriteReg(0x44,0x0E);                                                   
-    LCD_WriteReg(0x45,0x24);                                                  
-    LCD_WriteReg(0x46,0x04);                                                  
-    LCD_WriteReg(0x47,0x50);                                                   
-    LCD_WriteReg(0x48,0x02);                                                    
-    LCD_WriteReg(0x49,0x13);                                                  
-    LCD_WriteReg(0x4A,0x19);                                                  
-    LCD_WriteReg(0x4B,0x19);                                                 
-    LCD_WriteReg(0x4C,0x16);                                                 
-    LCD_WriteReg(0x50,0x1B);                                                   
-    LCD_WriteReg(0x51,0x31);                                                    
-    LCD_WriteReg(0x52,0x2F);                                                     
-    LCD_WriteReg(0x53,0x3F);                                                    
-    LCD_WriteReg(0x54,0x3F);                                                     
-    LCD_WriteReg(0x55,0x3E);                                                     
-    LCD_WriteReg(0x56,0x2F);                                                   
-    LCD_WriteReg(0x57,0x7B);                                                     
-    LCD_WriteReg(0x58,0x09);                                                  
-    LCD_WriteReg(0x59,0x06);                                                 
-    LCD_WriteReg(0x5A,0x06);                                                   
-    LCD_WriteReg(0x5B,0x0C);                                                   
-    LCD_WriteReg(0x5C,0x1D);                                                   
-    LCD_WriteReg(0x5D,0xCC);                                                   
-    //Power Voltage Setting
-    LCD_WriteReg(0x1B,0x18);                                                    
-    LCD_WriteReg(0x1A,0x01);                                                    
-    LCD_WriteReg(0x24,0x15);                                                    
-    LCD_WriteReg(0x25,0x50);                                                    
-    LCD_WriteReg(0x23,0x8B);                                                   
-    LCD_WriteReg(0x18,0x36);                           
-    LCD_WriteReg(0x19,0x01);                                                    
-    LCD_WriteReg(0x01,0x00);                                                   
-    LCD_WriteReg(0x1F,0x88);                                                    
-    delay_ms(50);
-    LCD_WriteReg(0x1F,0x80);                                                  
-    delay_ms(50);
-    LCD_WriteReg(0x1F,0x90);                                                   
-    delay_ms(50);
-    LCD_WriteReg(0x1F,0xD0);                                                   
-    delay_ms(50);
-    LCD_WriteReg(0x17,0x05);                                                    
-    LCD_WriteReg(0x36,0x00);                                                    
-    LCD_WriteReg(0x28,0x38);                                                 
-    delay_ms(50);
-    LCD_WriteReg(0x28,0x3C);                                                
-  }
-  if( DeviceCode == 0x7783 )
-  {
-    LCD_Code = ST7781;
-    //Start Initial Sequence
-    LCD_WriteReg(0x00FF,0x0001);
-    LCD_WriteReg(0x00F3,0x0008);
-    LCD_WriteReg(0x0001,0x0100);
-    LCD_WriteReg(0x0002,0x0700);
-    LCD_WriteReg(0x0003,0x1030);  
-    LCD_WriteReg(0x0008,0x0302);
-    LCD_WriteReg(0x0008,0x0207);
-    LCD_WriteReg(0x0009,0x0000);
-    LCD_WriteReg(0x000A,0x0000);
-    LCD_WriteReg(0x0010,0x0000);  
-    LCD_WriteReg(0x0011,0x0005);
-    LCD_WriteReg(0x0012,0x0000);
-    LCD_WriteReg(0x0013,0x0000);
-    delay_ms(50);
-    LCD_WriteReg(0x0010,0x12B0);
-    delay_ms(50);
-    LCD_WriteReg(0x0011,0x0007);
-    delay_ms(50);
-    LCD_WriteReg(0x0012,0x008B);
-    delay_ms(50);  
-    LCD_WriteReg(0x0013,0x1700);
-    delay_ms(50);  
-    LCD_WriteReg(0x0029,0x0022);    
-    LCD_WriteReg(0x0030,0x0000);
-    LCD_WriteReg(0x0031,0x0707);
-    LCD_WriteReg(0x0032,0x0505);
-    LCD_WriteReg(0x0035,0x0107);
-    LCD_WriteReg(0x0036,0x0008);
-    LCD_WriteReg(0x0037,0x0000);
-    LCD_WriteReg(0x0038,0x0202);
-    LCD_WriteReg(0x0039,0x0106);
-    LCD_WriteReg(0x003C,0x0202);
-    LCD_WriteReg(0x003D,0x0408);
-    delay_ms(50);        
-    LCD_WriteReg(0x0050,0x0000);    
-    LCD_WriteReg(0x0051,0x00EF);    
-    LCD_WriteReg(0x0052,0x0000);    
-    LCD_WriteReg(0x0053,0x013F);    
-    LCD_WriteReg(0x0060,0xA700);    
-    LCD_WriteReg(0x0061,0x0001);
-    LCD_WriteReg(0x0090,0x0033);        
-    LCD_WriteReg(0x002B,0x000B);    
-    LCD_WriteReg(0x0007,0x0133);
-  }
-  else // special ID
-  {
-    DeviceCode = LCD_ReadReg(0x67);
-    if( DeviceCode == 0x0046 )
-    {
-      LCD_Code = HX8346A;
-      //Gamma for CMO 3.2
-      LCD_WriteReg(0x46,0x94);
-      LCD_WriteReg(0x47,0x41);
-      LCD_WriteReg(0x48,0x00);
-      LCD_WriteReg(0x49,0x33);
-      LCD_WriteReg(0x4a,0x23);
-      LCD_WriteReg(0x4b,0x45);
-      LCD_WriteReg(0x4c,0x44);
-      LCD_WriteReg(0x4d,0x77);
-      LCD_WriteReg(0x4e,0x12);
-      LCD_WriteReg(0x4f,0xcc);
-      LCD_WriteReg(0x50,0x46);
-      LCD_WriteReg(0x51,0x82);
-      //240x320 window setting
-      LCD_WriteReg(0x02,0x00);
-      LCD_WriteReg(0x03,0x00);
-      LCD_WriteReg(0x04,0x01);
-      LCD_WriteReg(0x05,0x3f);
-      LCD_WriteReg(0x06,0x00);
-      LCD_WriteReg(0x07,0x00);
-      LCD_WriteReg(0x08,0x00); 
-      LCD_WriteReg(0x09,0xef);     
-      //Display Setting
-      LCD_WriteReg(0x01,0x06);            
-      LCD_WriteReg(0x16,0xC8);  //MY(1) MX(1) MV(0)
-      LCD_WriteReg(0x23,0x95);
-      LCD_WriteReg(0x24,0x95);
-      LCD_WriteReg(0x25,0xff);    
-      LCD_WriteReg(0x27,0x02);
-      LCD_WriteReg(0x28,0x02);
-      LCD_WriteReg(0x29,0x02);
-      LCD_WriteReg(0x2a,0x02);
-      LCD_WriteReg(0x2c,0x02);
-      LCD_WriteReg(0x2d,0x02);                
-      LCD_WriteReg(0x3a,0x01);
-      LCD_WriteReg(0x3b,0x01);
-      LCD_WriteReg(0x3c,0xf0);
-      LCD_WriteReg(0x3d,0x00);
-      delay_ms(2);
-      LCD_WriteReg(0x35,0x38);
-      LCD_WriteReg(0x36,0x78);  
-      LCD_WriteReg(0x3e,0x38);
-      LCD_WriteReg(0x40,0x0f);
-      LCD_WriteReg(0x41,0xf0);
-      //Power Supply Setting
-      LCD_WriteReg(0x19,0x49);
-      LCD_WriteReg(0x93,0x0f);
-      delay_ms(1);
-      LCD_WriteReg(0x20,0x30);
-      LCD_WriteReg(0x1d,0x07);
-      LCD_WriteReg(0x1e,0x00);
-      LCD_WriteReg(0x1f,0x07);
-      //VCOM Setting for CMO 3.2 Panel
-      LCD_WriteReg(0x44,0x4d);
-      LCD_WriteReg(0x45,0x13);
-      delay_ms(1);
-      LCD_WriteReg(0x1c,0x04);
-      delay_ms(2);
-      LCD_WriteReg(0x43,0x80);
-      delay_ms(5);
-      LCD_WriteReg(0x1b,0x08);
-      delay_ms(4);
-      LCD_WriteReg(0x1b,0x10);      
-      delay_ms(4);    
-      //Display ON Setting
-      LCD_WriteReg(0x90,0x7f);
-      LCD_WriteReg(0x26,0x04);
-      delay_ms(4);
-      LCD_WriteReg(0x26,0x24);
-      LCD_WriteReg(0x26,0x2c);
-      delay_ms(4);
-      LCD_WriteReg(0x26,0x3c);  
-      //Set internal VDDD voltage
-      LCD_WriteReg(0x57,0x02);
-      LCD_WriteReg(0x55,0x00);
-      LCD_WriteReg(0x57,0x00);
-    }
-    if( DeviceCode == 0x0047 )
-    {
-      LCD_Code = HX8347A;
-      LCD_WriteReg(0x0042,0x0008);   
-      //Gamma setting  
-      LCD_WriteReg(0x0046,0x00B4); 
-       LCD_WriteReg(0x0047,0x0043); 
-       LCD_WriteReg(0x0048,0x0013); 
-      LCD_WriteReg(0x0049,0x0047); 
-      LCD_WriteReg(0x004A,0x0014); 
-      LCD_WriteReg(0x004B,0x0036); 
-      LCD_WriteReg(0x004C,0x0003); 
-      LCD_WriteReg(0x004D,0x0046); 
-      LCD_WriteReg(0x004E,0x0005);  
-      LCD_WriteReg(0x004F,0x0010);  
-      LCD_WriteReg(0x0050,0x0008);  
-      LCD_WriteReg(0x0051,0x000a);  
-      //Window Setting
-       LCD_WriteReg(0x0002,0x0000); 
-      LCD_WriteReg(0x0003,0x0000); 
-      LCD_WriteReg(0x0004,0x0000); 
-      LCD_WriteReg(0x0005,0x00EF); 
-      LCD_WriteReg(0x0006,0x0000); 
-      LCD_WriteReg(0x0007,0x0000); 
-      LCD_WriteReg(0x0008,0x0001); 
-      LCD_WriteReg(0x0009,0x003F); 
-      delay_ms(10); 
-      LCD_WriteReg(0x0001,0x0006); 
-      LCD_WriteReg(0x0016,0x00C8);   
-      LCD_WriteReg(0x0023,0x0095); 
-      LCD_WriteReg(0x0024,0x0095); 
-      LCD_WriteReg(0x0025,0x00FF); 
-      LCD_WriteReg(0x0027,0x0002); 
-      LCD_WriteReg(0x0028,0x0002); 
-      LCD_WriteReg(0x0029,0x0002); 
-      LCD_WriteReg(0x002A,0x0002); 
-      LCD_WriteReg(0x002C,0x0002); 
-      LCD_WriteReg(0x002D,0x0002); 
-      LCD_WriteReg(0x003A,0x0001);  
-      LCD_WriteReg(0x003B,0x0001);  
-      LCD_WriteReg(0x003C,0x00F0);    
-      LCD_WriteReg(0x003D,0x0000); 
-      delay_ms(20); 
-      LCD_WriteReg(0x0035,0x0038); 
-      LCD_WriteReg(0x0036,0x0078); 
-      LCD_WriteReg(0x003E,0x0038); 
-      LCD_WriteReg(0x0040,0x000F); 
-      LCD_WriteReg(0x0041,0x00F0);  
-      LCD_WriteReg(0x0038,0x0000); 
-      //Power Setting 
-      LCD_WriteReg(0x0019,0x0049);  
-      LCD_WriteReg(0x0093,0x000A); 
-      delay_ms(10); 
-      LCD_WriteReg(0x0020,0x0020);   
-      LCD_WriteReg(0x001D,0x0003);   
-      LCD_WriteReg(0x001E,0x0000);  
-      LCD_WriteReg(0x001F,0x0009);   
-      LCD_WriteReg(0x0044,0x0053);  
-      LCD_WriteReg(0x0045,0x0010);   
-      delay_ms(10);  
-      LCD_WriteReg(0x001C,0x0004);  
-      delay_ms(20); 
-      LCD_WriteReg(0x0043,0x0080);    
-      delay_ms(5); 
-      LCD_WriteReg(0x001B,0x000a);    
-      delay_ms(40);  
-      LCD_WriteReg(0x001B,0x0012);    
-      delay_ms(40);   
-      //Display On Setting 
-      LCD_WriteReg(0x0090,0x007F); 
-      LCD_WriteReg(0x0026,0x0004); 
-      delay_ms(40);  
-      LCD_WriteReg(0x0026,0x0024); 
-      LCD_WriteReg(0x0026,0x002C); 
-      delay_ms(40);   
-      LCD_WriteReg(0x0070,0x0008); 
-      LCD_WriteReg(0x0026,0x003C);  
-      LCD_WriteReg(0x0057,0x0002); 
-      LCD_WriteReg(0x0055,0x0000); 
-      LCD_WriteReg(0x0057,0x0000); 
-    }   
-  }              
-  ---*/
-
-  delay_ms(50); // delay 50 ms  
+  (void)Line;
+  return 0;
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_Clear
-// Description    : 0xffff
-// Input          : - Color: Screen Color
-void LCD_Clear(uint16_t Color)
+// Function Name  : ILI932x_SetPartial
+// Description    : Partial image 1 or 2: display position R80h/R83h, GRAM
+//                  start and end lines R81h-R82h/R84h-R85h, enabled by
+//                  PTDE0/PTDE1 in R07h. Partial images are shown over the
+//                  base image and do not follow its scrolling.
+// Input          : - Image: 0 or 1
+//                  - Position: panel line the image starts on
+//                  - Start: first GRAM line of the image
+//                  - Lines: image height, 0 to switch the image off
+// Return         : 1
+static __attribute__((unused)) uint8_t ILI932x_SetPartial(uint8_t Image, uint16_t Position, uint16_t Start, uint16_t Lines)
 {
-  uint32_t index;
-  
-  if( LCD_Code == HX8347D || LCD_Code == HX8347A )
-  {
-    LCD_WriteReg(0x02,0x00);                                                  
-    LCD_WriteReg(0x03,0x00);  
-                    
-    LCD_WriteReg(0x04,0x00);                           
-    LCD_WriteReg(0x05,0xEF);  
-                     
-    LCD_WriteReg(0x06,0x00);                           
-    LCD_WriteReg(0x07,0x00);    
-                   
-    LCD_WriteReg(0x08,0x01);                           
-    LCD_WriteReg(0x09,0x3F);     
+  uint16_t reg = 0x0080 + 3 * Image;
+
+  if( Lines != 0 )
+  {
+    LCD_WriteReg(reg, Position );
+    LCD_WriteReg(reg + 1, Start );
+    LCD_WriteReg(reg + 2, Start + Lines - 1 );
+    LCD_PartialOn |= 0x1000 << Image;
   }
   else
-  {  
-    LCD_SetCursor(0,0); 
-  }  
-
-  LCD_WriteIndex(0x0022);
-  for( index = 0; index < MAX_X * MAX_Y; index++ )
   {
-    LCD_WriteData(Color);
+    LCD_PartialOn &= ~( 0x1000 << Image );
   }
+  LCD_WriteReg(0x0007, ( LCD_ReadReg(0x0007) & ~0x3000 ) | LCD_PartialOn );
+  return 1;
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_BGR2RGB
-// Description    : RRRRRGGGGGGBBBBB  BBBBBGGGGGGRRRRR 
-// Input          : - color: BRG
-static uint16_t LCD_BGR2RGB(uint16_t color)
+// Function Name  : LCD_NoPartial
+// Description    : Controllers whose partial display is not supported here
+// Return         : 0
+static __attribute__((unused)) uint8_t LCD_NoPartial(uint8_t Image, uint16_t Position, uint16_t Start, uint16_t Lines)
 {
-  uint16_t  r, g, b, rgb;
-  
-  b = ( color>>0 )  & 0x1f;
-  g = ( color>>5 )  & 0x3f;
-  r = ( color>>11 ) & 0x1f;
-  
-  rgb =  (b<<11) + (g<<5) + (r<<0);
-  
-  return( rgb );
+  (void)Image;
+  (void)Position;
+  (void)Start;
+  (void)Lines;
+  return 0;
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_GetPoint
-// Description    :
-// Input          : - Xpos: Row Coordinate
-//                  - Xpos: Line Coordinate 
-// Return          : Screen Color
-uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
+// Function Name  : LCD_WriteEntry
+// Description    : Writes the ID1/ID0/AM bits of an entry mode register;
+//                  the other bits (BGR, TRI, DFM...) come from the init
+//                  sequence, so they are read back and kept, once.
+// Input          : - Reg: entry mode register
+//                  - Mode: ENTRY_ bits
+static void LCD_WriteEntry(uint16_t Reg, uint16_t Mode)
 {
-  uint16_t dummy;
-  
-  LCD_SetCursor(Xpos,Ypos);
-  LCD_WriteIndex(0x0022);  
-  
-  switch( LCD_Code )
+  if( !LCD_EntryKnown )
   {
-    case ST7781:
-    case LGDP4531:
-    case LGDP4535:
-    case SSD1289:
-    case SSD1298:
-      dummy = LCD_ReadData(); // Empty read 
-      dummy = LCD_ReadData();   
-       return  dummy;        
-    case HX8347A:
-    case HX8347D:
-    {
-      uint8_t red,green,blue;
-        
-      dummy = LCD_ReadData(); // Empty read 
+    LCD_EntryReg = LCD_ReadReg(Reg) & ~ENTRY_MASK;
+    LCD_EntryKnown = 1;
+  }
+  LCD_WriteReg(Reg, LCD_EntryReg | Mode );
+}
 
-      red = LCD_ReadData() >> 3; 
-      green = LCD_ReadData() >> 2; 
-      blue = LCD_ReadData() >> 3; 
-      dummy = (uint16_t) ( ( red<<11 ) | ( green << 5 ) | blue ); 
-    }  
-      return  dummy;
 
-    default: // 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x9919 
-      dummy = LCD_ReadData(); // Empty read 
-      dummy = LCD_ReadData();   
-      return  LCD_BGR2RGB( dummy );
-  }
+//-----------------------------------------------------------------------------
+// Function Name  : ILI932x_SetEntry
+// Description    : Address counter direction, R03h
+// Input          : - Mode: ENTRY_ bits
+// Return         : 1
+static __attribute__((unused)) uint8_t ILI932x_SetEntry(uint16_t Mode)
+{
+  LCD_WriteEntry( 0x0003, Mode );
+  return 1;
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_SetPoint
-// Description    : 
-// Input          : - Xpos: Row Coordinate
-//                  - Ypos: Line Coordinate 
-void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
+// Function Name  : SSD1289_SetEntry
+// Description    : Address counter direction, R11h
+// Input          : - Mode: ENTRY_ bits
+// Return         : 1
+static __attribute__((unused)) uint8_t SSD1289_SetEntry(uint16_t Mode)
+{
+  LCD_WriteEntry( 0x0011, Mode );
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_NoEntry
+// Description    : Controllers whose entry mode is not supported here; they
+//                  keep the init sequence's horizontal increment
+// Return         : 0
+static __attribute__((unused)) uint8_t LCD_NoEntry(uint16_t Mode)
+{
+  (void)Mode;
+  return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BeginGRAMWrite
+// Description    : Selects GRAM (R22h) for the following data accesses; the
+//                  same on every supported controller
+static void LCD_BeginGRAMWrite(void)
+{
+  LCD_WriteIndex(0x0022);
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_MapPoint
+// Description    : Screen to panel coordinates for the current orientation;
+//                  at 0 degrees, the usual case, they are the same
+// Input          : - Xpos, Ypos: screen position, replaced by the panel one
+static __attribute__((always_inline)) void LCD_MapPoint(uint16_t *Xpos, uint16_t *Ypos)
 {
-  if( Xpos >= MAX_X || Ypos >= MAX_Y )
+  uint16_t x = *Xpos, y = *Ypos;
+
+  if( LCD_Rotation == 0 )
   {
     return;
   }
-  LCD_SetCursor(Xpos,Ypos);
-  LCD_WriteReg(0x0022,point);
+  switch( LCD_Rotation )
+  {
+    case 1:
+      *Xpos = y;
+      *Ypos = ( LCD_PANEL_Y - 1 ) - x;
+      break;
+    case 2:
+      *Xpos = ( LCD_PANEL_X - 1 ) - x;
+      *Ypos = ( LCD_PANEL_Y - 1 ) - y;
+      break;
+    case 3:
+      *Xpos = ( LCD_PANEL_X - 1 ) - y;
+      *Ypos = x;
+      break;
+    default:
+      break;
+  }
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_DrawLine
-// Description    : Bresenham's line algorithm
-// Input          : - x1: 
-//                  - y1: 
-//                  - x2: 
-//                  - y2:
-//                   - color: 
-void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color)
+// Function Name  : LCD_SetEntry
+// Description    : Programs the address counter direction if it changes
+// Input          : - Mode: ENTRY_ bits
+// Return         : 0 if the controller keeps its fixed direction
+static uint8_t LCD_SetEntry(uint16_t Mode)
 {
-  short dx,dy; 
-  short temp;  
-
-  if( x0 > x1 )   
+  if( Mode == LCD_EntryMode )
   {
-    temp = x1;
-    x1 = x0;
-    x0 = temp;   
+    return 1;
   }
-  if( y0 > y1 )   
+  if( !LCD_OP(SetEntry)( Mode ) )
   {
-    temp = y1;
-    y1 = y0;
-    y0 = temp;   
+    return 0;
   }
-  
-  dx = x1-x0; 
-  dy = y1-y0;   
+  LCD_EntryMode = Mode;
+  return 1;
+}
 
-  if( dx == 0 ) 
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ScanEntry
+// Description    : Entry mode that walks the screen along a scan order in
+//                  the current orientation: rows run along screen X, so
+//                  the panel axis and direction they follow turn with it.
+// Input          : - Scan: LCD_SCAN_ROWS or LCD_SCAN_COLUMNS
+// Return         : ENTRY_ bits
+static uint16_t LCD_ScanEntry(uint8_t Scan)
+{
+  static const uint8_t RowEntry[4] =
   {
-    do
-    { 
-      LCD_SetPoint(x0, y0, color);
-      y0++;
-    }
-    while( y1 >= y0 ); 
-    return; 
+    ENTRY_ID1 | ENTRY_ID0,  // 0:   X -> panel X+, Y -> panel Y+
+    ENTRY_AM  | ENTRY_ID0,  // 90:  X -> panel Y-, Y -> panel X+
+    0,                      // 180: X -> panel X-, Y -> panel Y-
+    ENTRY_AM  | ENTRY_ID1   // 270: X -> panel Y+, Y -> panel X-
+  };
+
+  return RowEntry[ LCD_Rotation ] ^ ( ( Scan == LCD_SCAN_COLUMNS ) ? ENTRY_AM : 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetWindowScan
+// Description    : Restricts GRAM access to a rectangle and puts the cursor
+//                  on its first pixel, the top-left one on the screen; data
+//                  writes then auto-increment along the scan order inside
+//                  the window, whatever the orientation.
+// Input          : - x0, y0: top-left corner (inclusive)
+//                  - x1, y1: bottom-right corner (inclusive)
+//                  - Scan: LCD_SCAN_ROWS or LCD_SCAN_COLUMNS
+// Return         : 0 if the controller cannot scan that way
+static uint8_t LCD_SetWindowScan(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t Scan)
+{
+  uint16_t t;
+
+  if( !LCD_SetEntry( LCD_ScanEntry( Scan ) ) )
+  {
+    return 0;
   }
-  if( dy == 0 )   
+
+  LCD_MapPoint( &x0, &y0 );
+  LCD_MapPoint( &x1, &y1 );
+  LCD_CurX = x0;
+  LCD_CurY = y0;
+  if( x0 > x1 )
   {
-    do
-    {
-      LCD_SetPoint(x0, y0, color);  
-      x0++;
-    }
-    while( x1 >= x0 ); 
-    return;
+    t = x0; x0 = x1; x1 = t;
   }
-  
-  // (Bresenham)
-  if( dx > dy )     
+  if( y0 > y1 )
   {
-    temp = 2 * dy - dx;          
-    while( x0 != x1 )
-    {
-      LCD_SetPoint(x0,y0,color);  
-      x0++;                     
-      if( temp > 0 )    
-      {
-        y0++;          
-        temp += 2 * dy - 2 * dx; 
-      }
-      else         
-      {
-        temp += 2 * dy; 
-      }       
-    }
-    LCD_SetPoint(x0,y0,color);
-  }  
-  else
+    t = y0; y0 = y1; y1 = t;
+  }
+  LCD_WindowActive = ( x0 != 0 || y0 != 0 || x1 != LCD_PANEL_X - 1 || y1 != LCD_PANEL_Y - 1 );
+
+  LCD_WinX0 = x0;
+  LCD_WinY0 = y0;
+  LCD_WinX1 = x1;
+  LCD_WinY1 = y1;
+
+  LCD_OP(SetWindow)( x0, y0, x1, y1 );
+  // Decrementing axes start at the far edge of the window
+  if( LCD_CurX != x0 || LCD_CurY != y0 )
   {
-    temp = 2 * dx - dy;    
-    while( y0 != y1 )
-    {
-      LCD_SetPoint(x0,y0,color);     
-      y0++;                 
-      if( temp > 0 )           
-      {
-        x0++;               
-        temp+=2*dy-2*dx; 
-      }
-      else
-      {
-        temp += 2 * dy;
-      }
-    } 
-    LCD_SetPoint(x0,y0,color);
+    LCD_OP(SetCursor)( LCD_CurX, LCD_CurY );
   }
-} 
+  return 1;
+}
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_PutChar
-// Description    :
-// Input          : - Xpos: 
-//                  - Ypos: 
-//                  - ASCI: 
-//                  - charColor:  
-//                  - bkColor:
-void LCD_PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor)
+// Function Name  : LCD_SetWindow
+// Description    : LCD_SetWindowScan in row order, which every controller
+//                  supports in its init orientation
+// Input          : - x0, y0: top-left corner (inclusive)
+//                  - x1, y1: bottom-right corner (inclusive)
+static void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  uint16_t i, j;
-  uint8_t buffer[16], tmp_char;
-  GetASCIICode(buffer,ASCI); 
-  for( i=0; i<16; i++ )
-  {
-    tmp_char = buffer[i];
-    for( j=0; j<8; j++ )
-    {
-      if( (tmp_char >> 7 - j) & 0x01 == 0x01 )
-      {
-        LCD_SetPoint( Xpos + j, Ypos + i, charColor ); 
-      }
-      else
-      {
-        LCD_SetPoint( Xpos + j, Ypos + i, bkColor ); 
-      }
-    }
-  }
+  (void)LCD_SetWindowScan( x0, y0, x1, y1, LCD_SCAN_ROWS );
 }
 
 
 //-----------------------------------------------------------------------------
-// Function Name  : LCD_PutText
-// Description    : 
-// Input          : - Xpos:
-//                  - Ypos:  
-//                  - str: 
-//                  - charColor:  
-//                  - bkColor: 
-void LCD_PutText(uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor)
+// Function Name  : LCD_ResetWindow
+// Description    : Restores the full-screen GRAM window if a previous
+//                  LCD_SetWindow narrowed it.
+static void LCD_ResetWindow(void)
 {
-  uint8_t TempChar;
-  do
+  if( LCD_WindowActive )
   {
-    TempChar = *str++;  
-    LCD_PutChar( Xpos, Ypos, TempChar, Color, bkColor );    
-    if( Xpos < MAX_X - 8 )
-    {
-      Xpos += 8;
-    } 
-    else if ( Ypos < MAX_Y - 16 )
-    {
-      Xpos = 0;
-      Ypos += 16;
-    }   
-    else
-    {
-      Xpos = 0;
-      Ypos = 0;
-    }    
+    LCD_SetWindow( 0, 0, LCD_Width - 1, LCD_Height - 1 );
   }
-  while ( *str != 0 );
 }
 
-/*******************************************************************************
-* Draw Bargraph                                                                *
-*   Parameter:      x:        horizontal position                              *
-*                   y:        vertical position                                *
-*                   w:        maximum width of bargraph (in pixels)            *
-*                   h:        bargraph height                                  *
-*                   val:      value of active bargraph (in 1/1024)             *
-*   Return:                                                                    *
-*******************************************************************************/
 
-void LCD_DrawBargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int h, 
-  unsigned int val, uint16_t barColor, uint16_t bkColor) 
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetPanelCursor
+// Description    : LCD_SetCursor for a position already in panel coordinates
+// Input          : - Xpos: panel X
+//                  - Ypos: panel Y
+static void LCD_SetPanelCursor(uint16_t Xpos,uint16_t Ypos)
 {
-  // Note: this is taken from the GLCD file of the MCB1700 board;
-  int i,j;
+  LCD_ResetWindow();
 
-  val = (val * w) >> 10; // scale value;
-  for (i = 0; i < h; i++) {
-    for (j = 0; j < w; j++) {
+  LCD_CurX = Xpos;
+  LCD_CurY = Ypos;
+
+  LCD_OP(SetCursor)( Xpos, Ypos );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetCursor
+// Description    : Sets the cursor position.
+// Input          : - Xpos: specifies the X position.
+//                  - Ypos: specifies the Y position. 
+static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
+{
+  LCD_MapPoint( &Xpos, &Ypos );
+  LCD_SetPanelCursor( Xpos, Ypos );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_StepAxis
+// Description    : Moves one coordinate of the modelled address counter by
+//                  one pixel inside [lo, hi], wrapping at the far edge.
+// Input          : - pos: coordinate to move
+//                  - lo, hi: window edges on that axis
+//                  - inc: 1 to increment, 0 to decrement
+// Return         : 1 if the coordinate wrapped
+static uint8_t LCD_StepAxis(uint16_t *pos, uint16_t lo, uint16_t hi, uint16_t inc)
+{
+  if( inc )
+  {
+    if( *pos < hi )
+    {
+      (*pos)++;
+      return 0;
+    }
+    *pos = lo;
+  }
+  else
+  {
+    if( *pos > lo )
+    {
+      (*pos)--;
+      return 0;
+    }
+    *pos = hi;
+  }
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_AdvanceCursor
+// Description    : Steps the modelled address counter the way the controller
+//                  does after a GRAM access: along the entry-mode direction,
+//                  wrapping at the window edges.
+static void LCD_AdvanceCursor(void)
+{
+  if( LCD_EntryMode & ENTRY_AM )
+  {
+    if( LCD_StepAxis( &LCD_CurY, LCD_WinY0, LCD_WinY1, LCD_EntryMode & ENTRY_ID1 ) )
+    {
+      LCD_StepAxis( &LCD_CurX, LCD_WinX0, LCD_WinX1, LCD_EntryMode & ENTRY_ID0 );
+    }
+  }
+  else
+  {
+    if( LCD_StepAxis( &LCD_CurX, LCD_WinX0, LCD_WinX1, LCD_EntryMode & ENTRY_ID0 ) )
+    {
+      LCD_StepAxis( &LCD_CurY, LCD_WinY0, LCD_WinY1, LCD_EntryMode & ENTRY_ID1 );
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_CursorAt
+// Description    : Tells whether the modelled address counter already points
+//                  at a pixel, so a bare data write lands there.
+// Input          : - Xpos: panel X
+//                  - Ypos: panel Y
+// Return         : 1 if no cursor setup is needed
+static uint8_t LCD_CursorAt(uint16_t Xpos,uint16_t Ypos)
+{
+  return ( LCD_CurValid && !LCD_WindowActive && LCD_CurX == Xpos && LCD_CurY == Ypos );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BGR2RGB
+// Description    : RRRRRGGGGGGBBBBB  BBBBBGGGGGGRRRRR 
+// Input          : - color: BRG
+static __attribute__((always_inline)) uint16_t LCD_BGR2RGB(uint16_t color)
+{
+  uint16_t  r, g, b, rgb;
+  
+  b = ( color>>0 )  & 0x1f;
+  g = ( color>>5 )  & 0x3f;
+  r = ( color>>11 ) & 0x1f;
+  
+  rgb =  (b<<11) + (g<<5) + (r<<0);
+  
+  return( rgb );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ReadPixelsRGB
+// Description    : GRAM read for 0x7783 0x4531 0x4535 0x8989 0x8999, one
+//                  word per pixel in RGB565 order
+// Input          : - pixels: buffer for count colors
+//                  - count: number of pixels
+static __attribute__((unused)) void LCD_ReadPixelsRGB(uint16_t *pixels, uint32_t count)
+{
+  while( count-- )
+  {
+    *pixels++ = LCD_ReadStream();
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ReadPixelsBGR
+// Description    : GRAM read for 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505
+//                  0x0505 0x9919 0x0046. The BGR bit of the entry mode
+//                  applies to written data only, so the GRAM holds, and
+//                  reads back, the panel's BGR order; it is swapped here
+// Input          : - pixels: buffer for count colors
+//                  - count: number of pixels
+static __attribute__((unused)) void LCD_ReadPixelsBGR(uint16_t *pixels, uint32_t count)
+{
+  while( count-- )
+  {
+    *pixels++ = LCD_BGR2RGB( LCD_ReadStream() );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : HX8347_ReadPixels
+// Description    : GRAM read for 0x0047, one word per color component
+// Input          : - pixels: buffer for count colors
+//                  - count: number of pixels
+static __attribute__((unused)) void HX8347_ReadPixels(uint16_t *pixels, uint32_t count)
+{
+  uint8_t red,green,blue;
+
+  while( count-- )
+  {
+    red = LCD_ReadStream() >> 3; 
+    green = LCD_ReadStream() >> 2; 
+    blue = LCD_ReadStream() >> 3; 
+    *pixels++ = (uint16_t) ( ( red<<11 ) | ( green << 5 ) | blue ); 
+  }
+}
+
+
+#if !defined( LCD_FIXED_CONTROLLER )
+static const LCD_DriverOps ILI932x_Ops = { ILI932x_SetCursor, ILI932x_SetWindow, LCD_BeginGRAMWrite, LCD_ReadPixelsBGR,  ILI932x_SetScroll, ILI932x_SetPartial, ILI932x_SetEntry };
+static const LCD_DriverOps ST7781_Ops  = { ILI932x_SetCursor, ILI932x_SetWindow, LCD_BeginGRAMWrite, LCD_ReadPixelsRGB,  ILI932x_SetScroll, ILI932x_SetPartial, ILI932x_SetEntry };
+static const LCD_DriverOps SSD1289_Ops = { SSD1289_SetCursor, SSD1289_SetWindow, LCD_BeginGRAMWrite, LCD_ReadPixelsRGB,  SSD1289_SetScroll, LCD_NoPartial,      SSD1289_SetEntry };
+static const LCD_DriverOps SSD2119_Ops = { SSD1289_SetCursor, SSD2119_SetWindow, LCD_BeginGRAMWrite, LCD_ReadPixelsBGR,  SSD1289_SetScroll, LCD_NoPartial,      SSD1289_SetEntry };
+static const LCD_DriverOps HX8346A_Ops = { HX8347_SetCursor,  HX8347_SetWindow,  LCD_BeginGRAMWrite, LCD_ReadPixelsBGR,  LCD_NoScroll,      LCD_NoPartial,      LCD_NoEntry };
+static const LCD_DriverOps HX8347_Ops  = { HX8347_SetCursor,  HX8347_SetWindow,  LCD_BeginGRAMWrite, HX8347_ReadPixels,  LCD_NoScroll,      LCD_NoPartial,      LCD_NoEntry };
+#endif
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SelectDriver
+// Description    : Picks the controller backend for the probed LCD_Code
+static void LCD_SelectDriver(void)
+{
+#if !defined( LCD_FIXED_CONTROLLER )
+  switch( LCD_Code )
+  {
+    default: // 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 
+      LCD_Ops = &ILI932x_Ops;
+      break;
+    case ST7781:
+    case LGDP4531:
+    case LGDP4535:
+      LCD_Ops = &ST7781_Ops;
+      break;
+    case SSD1289:
+    case SSD1298:
+      LCD_Ops = &SSD1289_Ops;
+      break;
+    case SSD2119:
+      LCD_Ops = &SSD2119_Ops;
+      break;
+    case HX8346A:
+      LCD_Ops = &HX8346A_Ops;
+      break;
+    case HX8347A:
+    case HX8347D:
+      LCD_Ops = &HX8347_Ops;
+      break;
+  }
+#endif
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_Delay
+// Description    : Delay Time
+// Input          : - nCount: Delay Time
+static void delay_ms(uint16_t ms)    
+{ 
+  uint16_t i,j; 
+  for( i = 0; i < ms; i++ )
+  { 
+    for( j = 0; j < 1141; j++ );
+  }
+} 
+
+
+//-----------------------------------------------------------------------------
+// Controller init sequences: each step writes Value to register Reg and then
+// waits Delay ms before the next step. They live in flash at 4 bytes a step,
+// so every controller can stay enabled (the old unrolled LCD_WriteReg calls
+// had to be commented out to fit the lite edition of uVision).
+// Values and delays are the vendor's. Some sequences leave a vertical entry
+// mode (ILI9320, R61505U: 0x1018), so once one has run the driver programs
+// the horizontal increment its sessions and cursor model rely on.
+typedef struct
+{
+  uint8_t  Reg;
+  uint8_t  Delay;
+  uint16_t Value;
+} LCD_InitStep;
+
+// ILI9325 / ILI9328 (0x9325 0x9328)
+static const LCD_InitStep ILI9325_InitSeq[] =
+{
+  { 0xE7,   0, 0x0010 },
+  { 0x00,   0, 0x0001 },                 // start internal osc
+  { 0x01,   0, 0x0100 },
+  { 0x02,   0, 0x0700 },                 // power on sequence
+  { 0x03,   0, (1<<12)|(1<<5)|(1<<4)|(0<<3) }, // importance
+  { 0x04,   0, 0x0000 },
+  { 0x08,   0, 0x0207 },
+  { 0x09,   0, 0x0000 },
+  { 0x0A,   0, 0x0000 },                 // display setting
+  { 0x0C,   0, 0x0001 },                 // display setting
+  { 0x0D,   0, 0x0000 },
+  { 0x0F,   0, 0x0000 },
+  // Power On sequence
+  { 0x10,   0, 0x0000 },
+  { 0x11,   0, 0x0007 },
+  { 0x12,   0, 0x0000 },
+  { 0x13,  50, 0x0000 },
+  { 0x10,   0, 0x1590 },
+  { 0x11,  50, 0x0227 },
+  { 0x12,  50, 0x009C },
+  { 0x13,   0, 0x1900 },
+  { 0x29,   0, 0x0023 },
+  { 0x2B,  50, 0x000E },
+  { 0x20,   0, 0x0000 },
+  { 0x21,  50, 0x0000 },
+  { 0x30,   0, 0x0007 },
+  { 0x31,   0, 0x0707 },
+  { 0x32,   0, 0x0006 },
+  { 0x35,   0, 0x0704 },
+  { 0x36,   0, 0x1F04 },
+  { 0x37,   0, 0x0004 },
+  { 0x38,   0, 0x0000 },
+  { 0x39,   0, 0x0706 },
+  { 0x3C,   0, 0x0701 },
+  { 0x3D,  50, 0x000F },
+  { 0x50,   0, 0x0000 },
+  { 0x51,   0, 0x00EF },
+  { 0x52,   0, 0x0000 },
+  { 0x53,   0, 0x013F },
+  { 0x60,   0, 0xA700 },
+  { 0x61,   0, 0x0001 },
+  { 0x6A,   0, 0x0000 },
+  { 0x80,   0, 0x0000 },
+  { 0x81,   0, 0x0000 },
+  { 0x82,   0, 0x0000 },
+  { 0x83,   0, 0x0000 },
+  { 0x84,   0, 0x0000 },
+  { 0x85,   0, 0x0000 },
+  { 0x90,   0, 0x0010 },
+  { 0x92,   0, 0x0000 },
+  { 0x93,   0, 0x0003 },
+  { 0x95,   0, 0x0110 },
+  { 0x97,   0, 0x0000 },
+  { 0x98,   0, 0x0000 },
+  // display on sequence
+  { 0x07,   0, 0x0133 },
+  { 0x20,   0, 0x0000 },
+  { 0x21,   0, 0x0000 },
+};
+
+// ILI9320 (0x9320 0x9300)
+static const LCD_InitStep ILI9320_InitSeq[] =
+{
+  { 0x00,   0, 0x0000 },
+  { 0x01,   0, 0x0100 },                 // Driver Output Contral
+  { 0x02,   0, 0x0700 },                 // LCD Driver Waveform Contral
+  { 0x03,   0, 0x1018 },                 // Entry Mode Set
+  { 0x04,   0, 0x0000 },                 // Scalling Contral
+  { 0x08,   0, 0x0202 },                 // Display Contral
+  { 0x09,   0, 0x0000 },                 // Display Contral 3.(0x0000)
+  { 0x0A,   0, 0x0000 },                 // Frame Cycle Contal.(0x0000)
+  { 0x0C,   0, (1<<0) },                 // Extern Display Interface Contral
+  { 0x0D,   0, 0x0000 },                 // Frame Maker Position
+  { 0x0F, 100, 0x0000 },                 // Extern Display Interface Contral 2.
+  { 0x07, 100, 0x0101 },                 // Display Contral
+  { 0x10,   0, (1<<12)|(0<<8)|(1<<7)|(1<<6)|(0<<4) }, // Power Control 1.(0x16b0)
+  { 0x11,   0, 0x0007 },                 // Power Control 2
+  { 0x12,   0, (1<<8)|(1<<4)|(0<<0) },   // Power Control 3.(0x0138)
+  { 0x13,   0, 0x0B00 },                 // Power Control 4
+  { 0x29,   0, 0x0000 },                 // Power Control 7
+  { 0x2B,   0, (1<<14)|(1<<4) },
+  { 0x50,   0, 0 },                      // Set X Start
+  { 0x51,   0, 239 },                    // Set X End
+  { 0x52,   0, 0 },                      // Set Y Start
+  { 0x53,   0, 319 },                    // Set Y End
+  { 0x60,   0, 0x2700 },                 // Driver Output Control
+  { 0x61,   0, 0x0001 },                 // Driver Output Control
+  { 0x6A,   0, 0x0000 },                 // Vertical Srcoll Control
+  { 0x80,   0, 0x0000 },                 // Display Position? Partial Display 1
+  { 0x81,   0, 0x0000 },                 // RAM Address Start? Partial Display 1
+  { 0x82,   0, 0x0000 },                 // RAM Address End-Partial Display 1
+  { 0x83,   0, 0x0000 },                 // Displsy Position? Partial Display 2
+  { 0x84,   0, 0x0000 },                 // RAM Address Start? Partial Display 2
+  { 0x85,   0, 0x0000 },                 // RAM Address End? Partial Display 2
+  { 0x90,   0, (0<<7)|(16<<0) },         // Frame Cycle Contral.(0x0013)
+  { 0x92,   0, 0x0000 },                 // Panel Interface Contral 2.(0x0000)
+  { 0x93,   0, 0x0001 },                 // Panel Interface Contral 3.
+  { 0x95,   0, 0x0110 },                 // Frame Cycle Contral.(0x0110)
+  { 0x97,   0, (0<<8) },
+  { 0x98,   0, 0x0000 },                 // Frame Cycle Contral
+  { 0x07,   0, 0x0173 },
+};
+
+// ILI9331 (0x9331)
+static const LCD_InitStep ILI9331_InitSeq[] =
+{
+  { 0xE7,   0, 0x1014 },
+  { 0x01,   0, 0x0100 },                 // set SS and SM bit
+  { 0x02,   0, 0x0200 },                 // set 1 line inversion
+  { 0x03,   0, 0x1030 },                 // set GRAM write direction and BGR=1
+  { 0x08,   0, 0x0202 },                 // set the back porch and front porch
+  { 0x09,   0, 0x0000 },                 // set non-display area refresh cycle ISC[3:0]
+  { 0x0A,   0, 0x0000 },                 // FMARK function
+  { 0x0C,   0, 0x0000 },                 // RGB interface setting
+  { 0x0D,   0, 0x0000 },                 // Frame marker Position
+  { 0x0F,   0, 0x0000 },                 // RGB interface polarity
+  // Power On sequence
+  { 0x10,   0, 0x0000 },                 // SAP, BT[3:0], AP, DSTB, SLP, STB
+  { 0x11,   0, 0x0007 },                 // DC1[2:0], DC0[2:0], VC[2:0]
+  { 0x12,   0, 0x0000 },                 // VREG1OUT voltage
+  { 0x13, 200, 0x0000 },                 // VDV[4:0] for VCOM amplitude
+  { 0x10,   0, 0x1690 },                 // SAP, BT[3:0], AP, DSTB, SLP, STB
+  { 0x11,  50, 0x0227 },                 // DC1[2:0], DC0[2:0], VC[2:0]
+  { 0x12,  50, 0x000C },                 // Internal reference voltage= Vci
+  { 0x13,   0, 0x0800 },                 // Set VDV[4:0] for VCOM amplitude
+  { 0x29,   0, 0x0011 },                 // Set VCM[5:0] for VCOMH
+  { 0x2B,  50, 0x000B },                 // Set Frame Rate
+  { 0x20,   0, 0x0000 },                 // GRAM horizontal Address
+  { 0x21,   0, 0x0000 },                 // GRAM Vertical Address
+  // Adjust the Gamma Curve
+  { 0x30,   0, 0x0000 },
+  { 0x31,   0, 0x0106 },
+  { 0x32,   0, 0x0000 },
+  { 0x35,   0, 0x0204 },
+  { 0x36,   0, 0x160A },
+  { 0x37,   0, 0x0707 },
+  { 0x38,   0, 0x0106 },
+  { 0x39,   0, 0x0707 },
+  { 0x3C,   0, 0x0402 },
+  { 0x3D,   0, 0x0C0F },
+  // Set GRAM area
+  { 0x50,   0, 0x0000 },                 // Horizontal GRAM Start Address
+  { 0x51,   0, 0x00EF },                 // Horizontal GRAM End Address
+  { 0x52,   0, 0x0000 },                 // Vertical GRAM Start Address
+  { 0x53,   0, 0x013F },                 // Vertical GRAM Start Address
+  { 0x60,   0, 0x2700 },                 // Gate Scan Line
+  { 0x61,   0, 0x0001 },                 // NDL,VLE, REV
+  { 0x6A,   0, 0x0000 },                 // set scrolling line
+  // Partial Display Control
+  { 0x80,   0, 0x0000 },
+  { 0x81,   0, 0x0000 },
+  { 0x82,   0, 0x0000 },
+  { 0x83,   0, 0x0000 },
+  { 0x84,   0, 0x0000 },
+  { 0x85,   0, 0x0000 },
+  // Panel Control
+  { 0x90,   0, 0x0010 },
+  { 0x92,   0, 0x0600 },
+  { 0x07,  50, 0x0021 },
+  { 0x07,  50, 0x0061 },
+  { 0x07,   0, 0x0133 },                 // 262K color and display ON
+};
+
+// SSD2119 (0x9919)
+static const LCD_InitStep SSD2119_InitSeq[] =
+{
+  // POWER ON &RESET DISPLAY OFF
+  { 0x28,   0, 0x0006 },
+  { 0x00,   0, 0x0001 },
+  { 0x10,   0, 0x0000 },
+  { 0x01,   0, 0x72EF },
+  { 0x02,   0, 0x0600 },
+  { 0x03,   0, 0x6A38 },
+  { 0x11,   0, 0x6874 },
+  { 0x0F,   0, 0x0000 },                 // RAM WRITE DATA MASK
+  { 0x0B,   0, 0x5308 },                 // RAM WRITE DATA MASK
+  { 0x0C,   0, 0x0003 },
+  { 0x0D,   0, 0x000A },
+  { 0x0E,   0, 0x2E00 },
+  { 0x1E,   0, 0x00BE },
+  { 0x25,   0, 0x8000 },
+  { 0x26,   0, 0x7800 },
+  { 0x27,   0, 0x0078 },
+  { 0x4E,   0, 0x0000 },
+  { 0x4F,   0, 0x0000 },
+  { 0x12,   0, 0x08D9 },
+  // Adjust the Gamma Curve
+  { 0x30,   0, 0x0000 },
+  { 0x31,   0, 0x0104 },
+  { 0x32,   0, 0x0100 },
+  { 0x33,   0, 0x0305 },
+  { 0x34,   0, 0x0505 },
+  { 0x35,   0, 0x0305 },
+  { 0x36,   0, 0x0707 },
+  { 0x37,   0, 0x0300 },
+  { 0x3A,   0, 0x1200 },
+  { 0x3B,   0, 0x0800 },
+  { 0x07,   0, 0x0033 },
+};
+
+// R61505U (0x1505 0x0505)
+static const LCD_InitStep R61505U_InitSeq[] =
+{
+  // initializing funciton
+  { 0xE5,   0, 0x8000 },                 // Set the internal vcore voltage
+  { 0x00,   0, 0x0001 },                 // start OSC
+  { 0x2B,   0, 0x0010 },                 // Set the frame rate as 80 when the internal resistor is used for oscillator circuit
+  { 0x01,   0, 0x0100 },                 // s720 to s1 ; G1 to G320
+  { 0x02,   0, 0x0700 },                 // set the line inversion
+  { 0x03,   0, 0x1018 },                 // 65536 colors
+  { 0x04,   0, 0x0000 },
+  { 0x08,   0, 0x0202 },                 // specify the line number of front and back porch periods respectively
+  { 0x09,   0, 0x0000 },
+  { 0x0A,   0, 0x0000 },
+  { 0x0C,   0, 0x0000 },                 // select internal system clock
+  { 0x0D,   0, 0x0000 },
+  { 0x0F,   0, 0x0000 },
+  { 0x50,   0, 0x0000 },                 // set windows adress
+  { 0x51,   0, 0x00EF },
+  { 0x52,   0, 0x0000 },
+  { 0x53,   0, 0x013F },
+  { 0x60,   0, 0x2700 },
+  { 0x61,   0, 0x0001 },
+  { 0x6A,   0, 0x0000 },
+  { 0x80,   0, 0x0000 },
+  { 0x81,   0, 0x0000 },
+  { 0x82,   0, 0x0000 },
+  { 0x83,   0, 0x0000 },
+  { 0x84,   0, 0x0000 },
+  { 0x85,   0, 0x0000 },
+  { 0x90,   0, 0x0010 },
+  { 0x92,   0, 0x0000 },
+  { 0x93,   0, 0x0003 },
+  { 0x95,   0, 0x0110 },
+  { 0x97,   0, 0x0000 },
+  { 0x98,   0, 0x0000 },
+  // power setting function
+  { 0x10,   0, 0x0000 },
+  { 0x11,   0, 0x0000 },
+  { 0x12,   0, 0x0000 },
+  { 0x13, 100, 0x0000 },
+  { 0x10,   0, 0x17B0 },
+  { 0x11,  50, 0x0004 },
+  { 0x12,  50, 0x013E },
+  { 0x13,   0, 0x1F00 },
+  { 0x29,  50, 0x000F },
+  { 0x20,   0, 0x0000 },
+  { 0x21,   0, 0x0000 },
+  // initializing function
+  { 0x30,   0, 0x0204 },
+  { 0x31,   0, 0x0001 },
+  { 0x32,   0, 0x0000 },
+  { 0x35,   0, 0x0206 },
+  { 0x36,   0, 0x0600 },
+  { 0x37,   0, 0x0500 },
+  { 0x38,   0, 0x0505 },
+  { 0x39,   0, 0x0407 },
+  { 0x3C,   0, 0x0500 },
+  { 0x3D,   0, 0x0503 },
+  // display on
+  { 0x07,   0, 0x0173 },
+};
+
+// SSD1289 (0x8989)
+static const LCD_InitStep SSD1289_InitSeq[] =
+{
+  { 0x00,  50, 0x0001 },
+  { 0x03,  50, 0xA8A4 },
+  { 0x0C,  50, 0x0000 },
+  { 0x0D,  50, 0x080C },
+  { 0x0E,  50, 0x2B00 },
+  { 0x1E,  50, 0x00B0 },
+  { 0x01,  50, 0x2B3F },                 // 320*240 0x2B3F
+  { 0x02,  50, 0x0600 },
+  { 0x10,  50, 0x0000 },
+  { 0x11,  50, 0x6070 },                 // 0x6070
+  { 0x05,  50, 0x0000 },
+  { 0x06,  50, 0x0000 },
+  { 0x16,  50, 0xEF1C },
+  { 0x17,  50, 0x0003 },
+  { 0x07,  50, 0x0133 },
+  { 0x0B,  50, 0x0000 },
+  { 0x0F,  50, 0x0000 },
+  { 0x41,  50, 0x0000 },
+  { 0x42,  50, 0x0000 },
+  { 0x48,  50, 0x0000 },
+  { 0x49,  50, 0x013F },
+  { 0x4A,  50, 0x0000 },
+  { 0x4B,  50, 0x0000 },
+  { 0x44,  50, 0xEF00 },
+  { 0x45,  50, 0x0000 },
+  { 0x46,  50, 0x013F },
+  { 0x30,  50, 0x0707 },
+  { 0x31,  50, 0x0204 },
+  { 0x32,  50, 0x0204 },
+  { 0x33,  50, 0x0502 },
+  { 0x34,  50, 0x0507 },
+  { 0x35,  50, 0x0204 },
+  { 0x36,  50, 0x0204 },
+  { 0x37,  50, 0x0502 },
+  { 0x3A,  50, 0x0302 },
+  { 0x3B,  50, 0x0302 },
+  { 0x23,  50, 0x0000 },
+  { 0x24,  50, 0x0000 },
+  { 0x25,  50, 0x8000 },
+  { 0x4F,   0, 0 },
+  { 0x4E,   0, 0 },
+};
+
+// SSD1298 (0x8999)
+static const LCD_InitStep SSD1298_InitSeq[] =
+{
+  { 0x28,   0, 0x0006 },
+  { 0x00,   0, 0x0001 },
+  { 0x03,   0, 0xAEA4 },                 // power control 1---line frequency and VHG,VGL voltage
+  { 0x0C,   0, 0x0004 },                 // power control 2---VCIX2 output voltage
+  { 0x0D,   0, 0x000C },                 // power control 3---Vlcd63 voltage
+  { 0x0E,   0, 0x2800 },                 // power control 4---VCOMA voltage VCOML=VCOMH*0.9475-VCOMA
+  { 0x1E,   0, 0x00B5 },                 // POWER CONTROL 5---VCOMH voltage
+  { 0x01,   0, 0x3B3F },
+  { 0x02,   0, 0x0600 },
+  { 0x10,   0, 0x0000 },
+  { 0x11,   0, 0x6830 },
+  { 0x05,   0, 0x0000 },
+  { 0x06,   0, 0x0000 },
+  { 0x16,   0, 0xEF1C },
+  { 0x07,   0, 0x0033 },                 // Display control 1
+  // when GON=1 and DTE=0,all gate outputs become VGL
+  // when GON=1 and DTE=0,all gate outputs become VGH
+  // non-selected gate wires become VGL
+  { 0x0B,   0, 0x0000 },
+  { 0x0F,   0, 0x0000 },
+  { 0x41,   0, 0x0000 },
+  { 0x42,   0, 0x0000 },
+  { 0x48,   0, 0x0000 },
+  { 0x49,   0, 0x013F },
+  { 0x4A,   0, 0x0000 },
+  { 0x4B,   0, 0x0000 },
+  { 0x44,   0, 0xEF00 },                 // Horizontal RAM start and end address
+  { 0x45,   0, 0x0000 },                 // Vretical RAM start address
+  { 0x46,   0, 0x013F },                 // Vretical RAM end address
+  { 0x4E,   0, 0x0000 },                 // set GDDRAM x address counter
+  { 0x4F,   0, 0x0000 },                 // set GDDRAM y address counter
+  // y control
+  { 0x30,   0, 0x0707 },
+  { 0x31,   0, 0x0202 },
+  { 0x32,   0, 0x0204 },
+  { 0x33,   0, 0x0502 },
+  { 0x34,   0, 0x0507 },
+  { 0x35,   0, 0x0204 },
+  { 0x36,   0, 0x0204 },
+  { 0x37,   0, 0x0502 },
+  { 0x3A,   0, 0x0302 },
+  { 0x3B,   0, 0x0302 },
+  { 0x23,   0, 0x0000 },
+  { 0x24,   0, 0x0000 },
+  { 0x25,   0, 0x8000 },
+  { 0x26,   0, 0x7000 },
+  { 0x20,   0, 0xB0EB },
+  { 0x27,   0, 0x007C },
+};
+
+// SPFD5408B (0x5408)
+static const LCD_InitStep SPFD5408B_InitSeq[] =
+{
+  { 0x01,   0, 0x0100 },                 // Driver Output Contral Register
+  { 0x02,   0, 0x0700 },                 // LCD Driving Waveform Contral
+  { 0x03,   0, 0x1030 },                 // Entry Mode
+  { 0x04,   0, 0x0000 },                 // Scalling Control register
+  { 0x08,   0, 0x0207 },                 // Display Control 2
+  { 0x09,   0, 0x0000 },                 // Display Control 3
+  { 0x0A,   0, 0x0000 },                 // Frame Cycle Control
+  { 0x0C,   0, 0x0000 },                 // External Display Interface Control 1
+  { 0x0D,   0, 0x0000 },                 // Frame Maker Position
+  { 0x0F,  50, 0x0000 },                 // External Display Interface Control 2
+  { 0x07,  50, 0x0101 },                 // Display Control
+  { 0x10,   0, 0x16B0 },                 // Power Control 1
+  { 0x11,   0, 0x0001 },                 // Power Control 2
+  { 0x17,   0, 0x0001 },                 // Power Control 3
+  { 0x12,   0, 0x0138 },                 // Power Control 4
+  { 0x13,   0, 0x0800 },                 // Power Control 5
+  { 0x29,   0, 0x0009 },                 // NVM read data 2
+  { 0x2A,   0, 0x0009 },                 // NVM read data 3
+  { 0xA4,   0, 0x0000 },
+  { 0x50,   0, 0x0000 },
+  { 0x51,   0, 0x00EF },
+  { 0x52,   0, 0x0000 },
+  { 0x53,   0, 0x013F },
+  { 0x60,   0, 0x2700 },                 // Driver Output Control
+  { 0x61,   0, 0x0003 },                 // Driver Output Control
+  { 0x6A,   0, 0x0000 },                 // Vertical Scroll Control
+  { 0x80,   0, 0x0000 },                 // Display Position - Partial Display 1
+  { 0x81,   0, 0x0000 },                 // RAM Address Start - Partial Display 1
+  { 0x82,   0, 0x0000 },                 // RAM address End - Partial Display 1
+  { 0x83,   0, 0x0000 },                 // Display Position - Partial Display 2
+  { 0x84,   0, 0x0000 },                 // RAM Address Start - Partial Display 2
+  { 0x85,   0, 0x0000 },                 // RAM address End - Partail Display2
+  { 0x90,   0, 0x0013 },                 // Frame Cycle Control
+  { 0x92,   0, 0x0000 },                 // Panel Interface Control 2
+  { 0x93,   0, 0x0003 },                 // Panel Interface control 3
+  { 0x95,   0, 0x0110 },                 // Frame Cycle Control
+  { 0x07,   0, 0x0173 },
+};
+
+// LGDP4531 (0x4531)
+static const LCD_InitStep LGDP4531_InitSeq[] =
+{
+  // Setup display
+  { 0x00,   0, 0x0001 },
+  { 0x10,   0, 0x0628 },
+  { 0x12,   0, 0x0006 },
+  { 0x13,   0, 0x0A32 },
+  { 0x11,   0, 0x0040 },
+  { 0x15,   0, 0x0050 },
+  { 0x12,  50, 0x0016 },
+  { 0x10,  50, 0x5660 },
+  { 0x13,   0, 0x2A4E },
+  { 0x01,   0, 0x0100 },
+  { 0x02,   0, 0x0300 },
+  { 0x03,   0, 0x1030 },
+  { 0x08,   0, 0x0202 },
+  { 0x0A,   0, 0x0000 },
+  { 0x30,   0, 0x0000 },
+  { 0x31,   0, 0x0402 },
+  { 0x32,   0, 0x0106 },
+  { 0x33,   0, 0x0700 },
+  { 0x34,   0, 0x0104 },
+  { 0x35,   0, 0x0301 },
+  { 0x36,   0, 0x0707 },
+  { 0x37,   0, 0x0305 },
+  { 0x38,   0, 0x0208 },
+  { 0x39,  50, 0x0F0B },
+  { 0x41,   0, 0x0002 },
+  { 0x60,   0, 0x2700 },
+  { 0x61,   0, 0x0001 },
+  { 0x90,   0, 0x0119 },
+  { 0x92,   0, 0x010A },
+  { 0x93,   0, 0x0004 },
+  { 0xA0,  50, 0x0100 },
+  { 0x07,  50, 0x0133 },
+  { 0xA0,   0, 0x0000 },
+};
+
+// LGDP4535 (0x4535)
+static const LCD_InitStep LGDP4535_InitSeq[] =
+{
+  { 0x15,   0, 0x0030 },                 // Set the internal vcore voltage
+  { 0x9A,   0, 0x0010 },                 // Start internal OSC
+  { 0x11,   0, 0x0020 },                 // set SS and SM bit
+  { 0x10,   0, 0x3428 },                 // set 1 line inversion
+  { 0x12,   0, 0x0002 },                 // set GRAM write direction and BGR=1
+  { 0x13,  40, 0x1038 },                 // Resize register
+  { 0x12,  40, 0x0012 },                 // set the back porch and front porch
+  { 0x10,   0, 0x3420 },                 // set non-display area refresh cycle ISC[3:0]
+  { 0x13,  70, 0x3045 },                 // FMARK function
+  { 0x30,   0, 0x0000 },                 // RGB interface setting
+  { 0x31,   0, 0x0402 },                 // Frame marker Position
+  { 0x32,   0, 0x0307 },                 // RGB interface polarity
+  { 0x33,   0, 0x0304 },                 // SAP, BT[3:0], AP, DSTB, SLP, STB
+  { 0x34,   0, 0x0004 },                 // DC1[2:0], DC0[2:0], VC[2:0]
+  { 0x35,   0, 0x0401 },                 // VREG1OUT voltage
+  { 0x36,   0, 0x0707 },                 // VDV[4:0] for VCOM amplitude
+  { 0x37,   0, 0x0305 },                 // SAP, BT[3:0], AP, DSTB, SLP, STB
+  { 0x38,   0, 0x0610 },                 // DC1[2:0], DC0[2:0], VC[2:0]
+  { 0x39,   0, 0x0610 },                 // VREG1OUT voltage
+  { 0x01,   0, 0x0100 },                 // VDV[4:0] for VCOM amplitude
+  { 0x02,   0, 0x0300 },                 // VCM[4:0] for VCOMH
+  { 0x03,   0, 0x1030 },                 // GRAM horizontal Address
+  { 0x08,   0, 0x0808 },                 // GRAM Vertical Address
+  { 0x0A,   0, 0x0008 },
+  { 0x60,   0, 0x2700 },                 // Gate Scan Line
+  { 0x61,   0, 0x0001 },                 // NDL,VLE, REV
+  { 0x90,   0, 0x013E },
+  { 0x92,   0, 0x0100 },
+  { 0x93,   0, 0x0100 },
+  { 0xA0,   0, 0x3000 },
+  { 0xA3,   0, 0x0010 },
+  { 0x07,   0, 0x0001 },
+  { 0x07,   0, 0x0021 },
+  { 0x07,   0, 0x0023 },
+  { 0x07,   0, 0x0033 },
+  { 0x07,   0, 0x0133 },
+};
+
+// HX8347D (0x0047)
+static const LCD_InitStep HX8347D_InitSeq[] =
+{
+  // Start Initial Sequence
+  { 0xEA,   0, 0x0000 },
+  { 0xEB,   0, 0x0020 },
+  { 0xEC,   0, 0x000C },
+  { 0xED,   0, 0x00C4 },
+  { 0xE8,   0, 0x0040 },
+  { 0xE9,   0, 0x0038 },
+  { 0xF1,   0, 0x0001 },
+  { 0xF2,   0, 0x0010 },
+  { 0x27,   0, 0x00A3 },
+  // GAMMA SETTING
+  { 0x40,   0, 0x0001 },
+  { 0x41,   0, 0x0000 },
+  { 0x42,   0, 0x0000 },
+  { 0x43,   0, 0x0010 },
+  { 0x44,   0, 0x000E },
+  { 0x45,   0, 0x0024 },
+  { 0x46,   0, 0x0004 },
+  { 0x47,   0, 0x0050 },
+  { 0x48,   0, 0x0002 },
+  { 0x49,   0, 0x0013 },
+  { 0x4A,   0, 0x0019 },
+  { 0x4B,   0, 0x0019 },
+  { 0x4C,   0, 0x0016 },
+  { 0x50,   0, 0x001B },
+  { 0x51,   0, 0x0031 },
+  { 0x52,   0, 0x002F },
+  { 0x53,   0, 0x003F },
+  { 0x54,   0, 0x003F },
+  { 0x55,   0, 0x003E },
+  { 0x56,   0, 0x002F },
+  { 0x57,   0, 0x007B },
+  { 0x58,   0, 0x0009 },
+  { 0x59,   0, 0x0006 },
+  { 0x5A,   0, 0x0006 },
+  { 0x5B,   0, 0x000C },
+  { 0x5C,   0, 0x001D },
+  { 0x5D,   0, 0x00CC },
+  // Power Voltage Setting
+  { 0x1B,   0, 0x0018 },
+  { 0x1A,   0, 0x0001 },
+  { 0x24,   0, 0x0015 },
+  { 0x25,   0, 0x0050 },
+  { 0x23,   0, 0x008B },
+  { 0x18,   0, 0x0036 },
+  { 0x19,   0, 0x0001 },
+  { 0x01,   0, 0x0000 },
+  { 0x1F,  50, 0x0088 },
+  { 0x1F,  50, 0x0080 },
+  { 0x1F,  50, 0x0090 },
+  { 0x1F,  50, 0x00D0 },
+  { 0x17,   0, 0x0005 },
+  { 0x36,   0, 0x0000 },
+  { 0x28,  50, 0x0038 },
+  { 0x28,   0, 0x003C },
+};
+
+// ST7781 (0x7783)
+static const LCD_InitStep ST7781_InitSeq[] =
+{
+  // Start Initial Sequence
+  { 0xFF,   0, 0x0001 },
+  { 0xF3,   0, 0x0008 },
+  { 0x01,   0, 0x0100 },
+  { 0x02,   0, 0x0700 },
+  { 0x03,   0, 0x1030 },
+  { 0x08,   0, 0x0302 },
+  { 0x08,   0, 0x0207 },
+  { 0x09,   0, 0x0000 },
+  { 0x0A,   0, 0x0000 },
+  { 0x10,   0, 0x0000 },
+  { 0x11,   0, 0x0005 },
+  { 0x12,   0, 0x0000 },
+  { 0x13,  50, 0x0000 },
+  { 0x10,  50, 0x12B0 },
+  { 0x11,  50, 0x0007 },
+  { 0x12,  50, 0x008B },
+  { 0x13,  50, 0x1700 },
+  { 0x29,   0, 0x0022 },
+  { 0x30,   0, 0x0000 },
+  { 0x31,   0, 0x0707 },
+  { 0x32,   0, 0x0505 },
+  { 0x35,   0, 0x0107 },
+  { 0x36,   0, 0x0008 },
+  { 0x37,   0, 0x0000 },
+  { 0x38,   0, 0x0202 },
+  { 0x39,   0, 0x0106 },
+  { 0x3C,   0, 0x0202 },
+  { 0x3D,  50, 0x0408 },
+  { 0x50,   0, 0x0000 },
+  { 0x51,   0, 0x00EF },
+  { 0x52,   0, 0x0000 },
+  { 0x53,   0, 0x013F },
+  { 0x60,   0, 0xA700 },
+  { 0x61,   0, 0x0001 },
+  { 0x90,   0, 0x0033 },
+  { 0x2B,   0, 0x000B },
+  { 0x07,   0, 0x0133 },
+};
+
+// HX8346A (R67h = 0x0046)
+static const LCD_InitStep HX8346A_InitSeq[] =
+{
+  // Gamma for CMO 3.2
+  { 0x46,   0, 0x0094 },
+  { 0x47,   0, 0x0041 },
+  { 0x48,   0, 0x0000 },
+  { 0x49,   0, 0x0033 },
+  { 0x4A,   0, 0x0023 },
+  { 0x4B,   0, 0x0045 },
+  { 0x4C,   0, 0x0044 },
+  { 0x4D,   0, 0x0077 },
+  { 0x4E,   0, 0x0012 },
+  { 0x4F,   0, 0x00CC },
+  { 0x50,   0, 0x0046 },
+  { 0x51,   0, 0x0082 },
+  // 240x320 window setting
+  { 0x02,   0, 0x0000 },
+  { 0x03,   0, 0x0000 },
+  { 0x04,   0, 0x0001 },
+  { 0x05,   0, 0x003F },
+  { 0x06,   0, 0x0000 },
+  { 0x07,   0, 0x0000 },
+  { 0x08,   0, 0x0000 },
+  { 0x09,   0, 0x00EF },
+  // Display Setting
+  { 0x01,   0, 0x0006 },
+  { 0x16,   0, 0x00C8 },                 // MY(1) MX(1) MV(0)
+  { 0x23,   0, 0x0095 },
+  { 0x24,   0, 0x0095 },
+  { 0x25,   0, 0x00FF },
+  { 0x27,   0, 0x0002 },
+  { 0x28,   0, 0x0002 },
+  { 0x29,   0, 0x0002 },
+  { 0x2A,   0, 0x0002 },
+  { 0x2C,   0, 0x0002 },
+  { 0x2D,   0, 0x0002 },
+  { 0x3A,   0, 0x0001 },
+  { 0x3B,   0, 0x0001 },
+  { 0x3C,   0, 0x00F0 },
+  { 0x3D,   2, 0x0000 },
+  { 0x35,   0, 0x0038 },
+  { 0x36,   0, 0x0078 },
+  { 0x3E,   0, 0x0038 },
+  { 0x40,   0, 0x000F },
+  { 0x41,   0, 0x00F0 },
+  // Power Supply Setting
+  { 0x19,   0, 0x0049 },
+  { 0x93,   1, 0x000F },
+  { 0x20,   0, 0x0030 },
+  { 0x1D,   0, 0x0007 },
+  { 0x1E,   0, 0x0000 },
+  { 0x1F,   0, 0x0007 },
+  // VCOM Setting for CMO 3.2 Panel
+  { 0x44,   0, 0x004D },
+  { 0x45,   1, 0x0013 },
+  { 0x1C,   2, 0x0004 },
+  { 0x43,   5, 0x0080 },
+  { 0x1B,   4, 0x0008 },
+  { 0x1B,   4, 0x0010 },
+  // Display ON Setting
+  { 0x90,   0, 0x007F },
+  { 0x26,   4, 0x0004 },
+  { 0x26,   0, 0x0024 },
+  { 0x26,   4, 0x002C },
+  { 0x26,   0, 0x003C },
+  // Set internal VDDD voltage
+  { 0x57,   0, 0x0002 },
+  { 0x55,   0, 0x0000 },
+  { 0x57,   0, 0x0000 },
+};
+
+// HX8347A (R67h = 0x0047)
+static const LCD_InitStep HX8347A_InitSeq[] =
+{
+  { 0x42,   0, 0x0008 },
+  // Gamma setting
+  { 0x46,   0, 0x00B4 },
+  { 0x47,   0, 0x0043 },
+  { 0x48,   0, 0x0013 },
+  { 0x49,   0, 0x0047 },
+  { 0x4A,   0, 0x0014 },
+  { 0x4B,   0, 0x0036 },
+  { 0x4C,   0, 0x0003 },
+  { 0x4D,   0, 0x0046 },
+  { 0x4E,   0, 0x0005 },
+  { 0x4F,   0, 0x0010 },
+  { 0x50,   0, 0x0008 },
+  { 0x51,   0, 0x000A },
+  // Window Setting
+  { 0x02,   0, 0x0000 },
+  { 0x03,   0, 0x0000 },
+  { 0x04,   0, 0x0000 },
+  { 0x05,   0, 0x00EF },
+  { 0x06,   0, 0x0000 },
+  { 0x07,   0, 0x0000 },
+  { 0x08,   0, 0x0001 },
+  { 0x09,  10, 0x003F },
+  { 0x01,   0, 0x0006 },
+  { 0x16,   0, 0x00C8 },
+  { 0x23,   0, 0x0095 },
+  { 0x24,   0, 0x0095 },
+  { 0x25,   0, 0x00FF },
+  { 0x27,   0, 0x0002 },
+  { 0x28,   0, 0x0002 },
+  { 0x29,   0, 0x0002 },
+  { 0x2A,   0, 0x0002 },
+  { 0x2C,   0, 0x0002 },
+  { 0x2D,   0, 0x0002 },
+  { 0x3A,   0, 0x0001 },
+  { 0x3B,   0, 0x0001 },
+  { 0x3C,   0, 0x00F0 },
+  { 0x3D,  20, 0x0000 },
+  { 0x35,   0, 0x0038 },
+  { 0x36,   0, 0x0078 },
+  { 0x3E,   0, 0x0038 },
+  { 0x40,   0, 0x000F },
+  { 0x41,   0, 0x00F0 },
+  { 0x38,   0, 0x0000 },
+  // Power Setting
+  { 0x19,   0, 0x0049 },
+  { 0x93,  10, 0x000A },
+  { 0x20,   0, 0x0020 },
+  { 0x1D,   0, 0x0003 },
+  { 0x1E,   0, 0x0000 },
+  { 0x1F,   0, 0x0009 },
+  { 0x44,   0, 0x0053 },
+  { 0x45,  10, 0x0010 },
+  { 0x1C,  20, 0x0004 },
+  { 0x43,   5, 0x0080 },
+  { 0x1B,  40, 0x000A },
+  { 0x1B,  40, 0x0012 },
+  // Display On Setting
+  { 0x90,   0, 0x007F },
+  { 0x26,  40, 0x0004 },
+  { 0x26,   0, 0x0024 },
+  { 0x26,  40, 0x002C },
+  { 0x70,   0, 0x0008 },
+  { 0x26,   0, 0x003C },
+  { 0x57,   0, 0x0002 },
+  { 0x55,   0, 0x0000 },
+  { 0x57,   0, 0x0000 },
+};
+
+typedef struct
+{
+  uint8_t  IdReg;       // register holding the device code
+  uint8_t  Code;        // value for LCD_Code
+  uint16_t DeviceCode;
+  uint16_t Count;
+  const LCD_InitStep *Steps;
+} LCD_InitSequence;
+
+#define LCD_INIT_SEQ(reg, id, code, seq)  { reg, code, id, sizeof(seq) / sizeof(seq[0]), seq }
+
+static const LCD_InitSequence LCD_InitSequences[] =
+{
+  LCD_INIT_SEQ( 0x00, 0x9325, ILI9325,   ILI9325_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x9328, ILI9325,   ILI9325_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x9320, ILI9320,   ILI9320_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x9300, ILI9320,   ILI9320_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x9331, ILI9331,   ILI9331_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x9919, SSD2119,   SSD2119_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x1505, R61505U,   R61505U_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x0505, R61505U,   R61505U_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x8989, SSD1289,   SSD1289_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x8999, SSD1298,   SSD1298_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x5408, SPFD5408B, SPFD5408B_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x4531, LGDP4531,  LGDP4531_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x4535, LGDP4535,  LGDP4535_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x0047, HX8347D,   HX8347D_InitSeq ),
+  LCD_INIT_SEQ( 0x00, 0x7783, ST7781,    ST7781_InitSeq ),
+  LCD_INIT_SEQ( 0x67, 0x0046, HX8346A,   HX8346A_InitSeq ), // special ID
+  LCD_INIT_SEQ( 0x67, 0x0047, HX8347A,   HX8347A_InitSeq ), // special ID
+};
+
+#define  LCD_INIT_POWERUP  0   // waiting for the panel supply to settle
+#define  LCD_INIT_RUN      1   // walking the init sequence
+#define  LCD_INIT_SETTLE   2   // last delay before the first frame
+#define  LCD_INIT_DONE     3
+
+static uint8_t  LCD_InitState = LCD_INIT_DONE;
+static const LCD_InitStep *LCD_InitNext;
+static uint16_t LCD_InitLeft;
+static uint32_t LCD_InitSince;   // time the current wait began, ms
+static uint32_t LCD_InitWait;    // length of the current wait, ms
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_FindInitSequence
+// Description    : Looks up the init sequence for a probed device code
+// Input          : - IdReg: register the code was read from
+//                  - DeviceCode: value read back
+// Return         : 1 if the controller is known
+static uint8_t LCD_FindInitSequence(uint8_t IdReg, uint16_t DeviceCode)
+{
+  uint8_t i;
+
+  for( i = 0; i < sizeof(LCD_InitSequences) / sizeof(LCD_InitSequences[0]); i++ )
+  {
+    if( LCD_InitSequences[i].IdReg == IdReg && LCD_InitSequences[i].DeviceCode == DeviceCode )
+    {
+      LCD_Code = LCD_InitSequences[i].Code;
+      LCD_InitNext = LCD_InitSequences[i].Steps;
+      LCD_InitLeft = LCD_InitSequences[i].Count;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_StartInitialization
+// Description    : Starts a non-blocking controller init; the caller then
+//                  polls LCD_PollInitialization with a running ms clock and
+//                  is free to do other work during the panel's delays.
+// Input          : - Now: current time in ms
+void LCD_StartInitialization(uint32_t Now)
+{
+  uint8_t i;
+
+  LCD_Configuration();
+  LCD_ScrollOn = 0;
+  LCD_PartialOn = 0;
+  LCD_EntryMode = ENTRY_ID1 | ENTRY_ID0;
+  LCD_EntryKnown = 0;
+  LCD_Rotation = 0;
+  LCD_Width = LCD_PANEL_X;
+  LCD_Height = LCD_PANEL_Y;
+  LCD_WindowActive = 0;          // the init sequences open the full window
+  LCD_WinX0 = 0;
+  LCD_WinY0 = 0;
+  LCD_WinX1 = LCD_PANEL_X - 1;
+  LCD_WinY1 = LCD_PANEL_Y - 1;
+  for( i = 0; i < LCD_PARTIAL_IMAGES; i++ )
+  {
+    LCD_PartialLines[i] = 0;
+  }
+  LCD_InitLeft = 0;
+  LCD_InitState = LCD_INIT_POWERUP;
+  LCD_InitSince = Now;
+  LCD_InitWait = 100;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PollInitialization
+// Description    : Advances the controller init: once the pending delay,
+//                  padded by LCD_INIT_TICK_MS, has elapsed, probes the
+//                  controller or writes init steps up to the next one that
+//                  needs a delay.
+// Input          : - Now: current time in ms
+// Return         : 1 once the display is ready to draw
+uint8_t LCD_PollInitialization(uint32_t Now)
+{
+  if( LCD_InitState == LCD_INIT_DONE )
+  {
+    return 1;
+  }
+  if( Now - LCD_InitSince < LCD_InitWait + LCD_INIT_TICK_MS )
+  {
+    return 0;
+  }
+  LCD_InitSince = Now;
+  LCD_InitWait = 0;
+
+  switch( LCD_InitState )
+  {
+    case LCD_INIT_POWERUP:
+      if( !LCD_FindInitSequence( 0x00, LCD_ReadReg(0x0000) ) )
+      {
+        (void)LCD_FindInitSequence( 0x67, LCD_ReadReg(0x0067) );
+      }
+      LCD_InitState = LCD_INIT_RUN;
+      // fall through
+    case LCD_INIT_RUN:
+      while( LCD_InitLeft != 0 && LCD_InitWait == 0 )
+      {
+        LCD_WriteReg( LCD_InitNext->Reg, LCD_InitNext->Value );
+        LCD_InitWait = LCD_InitNext->Delay;
+        LCD_InitNext++;
+        LCD_InitLeft--;
+      }
+      if( LCD_InitLeft == 0 )
+      {
+        LCD_SelectDriver();
+        LCD_InitWait += 50;
+        LCD_InitState = LCD_INIT_SETTLE;
+      }
+      return 0;
+    default:
+      LCD_InitState = LCD_INIT_DONE;
+      (void)LCD_OP(SetEntry)( LCD_EntryMode );  // see the init sequences
+      (void)LCD_SetOrientation( DISP_ORIENTATION );
+      return 1;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_Initialization
+// Description    : Initialize TFT Controller, blocking until it is ready
+void LCD_Initialization(void)
+{
+  uint32_t now = 0;
+
+  LCD_StartInitialization( now );
+  while( !LCD_PollInitialization( now ) )
+  {
+    delay_ms(1);
+    now++;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PushClip
+// Description    : Narrows drawing to a rectangle, intersected with the
+//                  current clip, until the matching LCD_PopClip. All
+//                  primitives except the raw LCD_BeginWrite session clip to
+//                  it once per call, so clipped pixels cost no bus cycles.
+// Input          : - Xpos, Ypos: top-left corner, may lie off the screen
+//                  - Width, Height: size in pixels
+// Return         : 0 if the stack is full and nothing was pushed
+uint8_t LCD_PushClip(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_ClipRect clip = LCD_CLIP;
+  int32_t x1 = (int32_t)Xpos + Width, y1 = (int32_t)Ypos + Height;
+
+  if( LCD_ClipLevel + 1 >= LCD_CLIP_DEPTH )
+  {
+    return 0;
+  }
+  if( Xpos > clip.x0 )
+  {
+    clip.x0 = Xpos;
+  }
+  if( Ypos > clip.y0 )
+  {
+    clip.y0 = Ypos;
+  }
+  if( x1 < clip.x1 )
+  {
+    clip.x1 = (int16_t)x1;
+  }
+  if( y1 < clip.y1 )
+  {
+    clip.y1 = (int16_t)y1;
+  }
+  // An empty clip stays empty instead of turning inside out
+  if( clip.x1 < clip.x0 )
+  {
+    clip.x1 = clip.x0;
+  }
+  if( clip.y1 < clip.y0 )
+  {
+    clip.y1 = clip.y0;
+  }
+
+  LCD_ClipStack[ ++LCD_ClipLevel ] = clip;
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PopClip
+// Description    : Restores the clip rectangle in effect before the last
+//                  LCD_PushClip; the whole-screen level is never popped.
+void LCD_PopClip(void)
+{
+  if( LCD_ClipLevel > 0 )
+  {
+    LCD_ClipLevel--;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ClipContains
+// Description    : Tells whether a rectangle lies entirely inside the clip,
+//                  so a caller may draw it through an unclipped session.
+// Input          : - Xpos, Ypos: top-left corner, may lie off the screen
+//                  - Width, Height: size in pixels
+// Return         : 1 if nothing of the rectangle would be clipped
+uint8_t LCD_ClipContains(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  return ( Xpos >= LCD_CLIP.x0 && Ypos >= LCD_CLIP.y0 &&
+           (int32_t)Xpos + Width <= LCD_CLIP.x1 && (int32_t)Ypos + Height <= LCD_CLIP.y1 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ClipBlit
+// Description    : Clips a bitmap placed at a signed position against the
+//                  clip rectangle. On return the position and size describe
+//                  the visible part and SkipX/SkipY the bitmap pixels cut
+//                  off at its left and top edges.
+// Input          : - Xpos, Ypos: top-left corner, may lie off the screen
+//                  - Width, Height: bitmap size in pixels
+//                  - SkipX, SkipY: clipped columns and rows
+// Return         : 0 if nothing of the bitmap is visible
+static uint8_t LCD_ClipBlit(int16_t *Xpos, int16_t *Ypos, uint16_t *Width, uint16_t *Height,
+                            uint16_t *SkipX, uint16_t *SkipY)
+{
+  int32_t x0 = *Xpos, y0 = *Ypos;
+  int32_t x1 = x0 + *Width, y1 = y0 + *Height;
+
+  *SkipX = ( x0 < LCD_CLIP.x0 ) ? (uint16_t)( LCD_CLIP.x0 - x0 ) : 0;
+  *SkipY = ( y0 < LCD_CLIP.y0 ) ? (uint16_t)( LCD_CLIP.y0 - y0 ) : 0;
+  x0 += *SkipX;
+  y0 += *SkipY;
+  if( x1 > LCD_CLIP.x1 )
+  {
+    x1 = LCD_CLIP.x1;
+  }
+  if( y1 > LCD_CLIP.y1 )
+  {
+    y1 = LCD_CLIP.y1;
+  }
+  if( x0 >= x1 || y0 >= y1 )
+  {
+    return 0;
+  }
+  *Xpos = (int16_t)x0;
+  *Ypos = (int16_t)y0;
+  *Width = (uint16_t)( x1 - x0 );
+  *Height = (uint16_t)( y1 - y0 );
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_Clear
+// Description    : Fills the screen, or what the clip rectangle leaves of it,
+//                  except the GRAM lines held by partial images
+// Input          : - Color: Screen Color
+void LCD_Clear(uint16_t Color)
+{
+  uint16_t y, lines;
+
+  // The held lines are panel lines, which turn with the screen
+  for( y = LCD_BaseLines( 0, &lines ); lines != 0; y = LCD_BaseLines( y + lines, &lines ) )
+  {
+    switch( LCD_Rotation )
+    {
+      case 1:
+        LCD_FillRect( LCD_PANEL_Y - y - lines, 0, lines, LCD_Height, Color );
+        break;
+      case 2:
+        LCD_FillRect( 0, LCD_PANEL_Y - y - lines, LCD_Width, lines, Color );
+        break;
+      case 3:
+        LCD_FillRect( y, 0, lines, LCD_Height, Color );
+        break;
+      default:
+        LCD_FillRect( 0, y, LCD_Width, lines, Color );
+        break;
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_FillRect
+// Description    : Fills a rectangle with one color through a GRAM window,
+//                  so the cursor is programmed once instead of per pixel;
+//                  the part outside the clip rectangle is left untouched.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: rectangle width in pixels
+//                  - Height: rectangle height in pixels
+//                  - Color: fill color
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color)
+{
+  int16_t x = (int16_t)Xpos, y = (int16_t)Ypos;
+  uint16_t skipX, skipY;
+
+  if( !LCD_ClipBlit( &x, &y, &Width, &Height, &skipX, &skipY ) )
+  {
+    return;
+  }
+
+  LCD_BeginWrite( x, y, Width, Height );
+  LCD_WriteRepeat( Color, (uint32_t)Width * Height );
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BeginWrite
+// Description    : Opens a GRAM write session on a rectangle: the window is
+//                  programmed, then CS and RS are asserted once and stay
+//                  asserted until LCD_EndWrite. Pixels are streamed row by
+//                  row; the rectangle must lie entirely on the screen.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: rectangle width in pixels
+//                  - Height: rectangle height in pixels
+void LCD_BeginWrite(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  LCD_SetWindow( Xpos, Ypos, Xpos + Width - 1, Ypos + Height - 1 );
+  LCD_OP(BeginGRAMWrite)();
+  LCD_CS(0);
+  LCD_RS(1);
+  LPC_GPIO0->FIOMASK = ~( PIN_LE | PIN_WR );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BeginWriteColumns
+// Description    : Like LCD_BeginWrite, but the pixels are streamed column
+//                  by column, top to bottom, for primitives whose data
+//                  naturally runs down the screen; the address counter
+//                  then moves vertically first, so the burst stays
+//                  sequential.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: rectangle width in pixels
+//                  - Height: rectangle height in pixels
+// Return         : 0 if the controller cannot scan columns; no session is
+//                  opened then
+uint8_t LCD_BeginWriteColumns(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+  if( !LCD_SetWindowScan( Xpos, Ypos, Xpos + Width - 1, Ypos + Height - 1, LCD_SCAN_COLUMNS ) )
+  {
+    return 0;
+  }
+  LCD_OP(BeginGRAMWrite)();
+  LCD_CS(0);
+  LCD_RS(1);
+  LPC_GPIO0->FIOMASK = ~( PIN_LE | PIN_WR );
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_WritePixels
+// Description    : Streams pixels into the open write session.
+// Input          : - pixels: RGB565 colors
+//                  - count: number of pixels
+void LCD_WritePixels(const uint16_t *pixels, uint32_t count)
+{
+  while( count-- )
+  {
+    LCD_WriteStream( *pixels++ );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_WriteRepeat
+// Description    : Streams the same color into the open write session.
+// Input          : - Color: RGB565 color
+//                  - count: number of pixels
+void LCD_WriteRepeat(uint16_t Color, uint32_t count)
+{
+  while( count-- )
+  {
+    LCD_WriteStream( Color );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_WriteScaled
+// Description    : Streams pixels into the open write session, each one
+//                  repeated Scale times, for upscaling a line.
+// Input          : - pixels: RGB565 colors
+//                  - count: number of source pixels
+//                  - Scale: repeats per source pixel
+void LCD_WriteScaled(const uint16_t *pixels, uint32_t count, uint8_t Scale)
+{
+  uint8_t i;
+
+  while( count-- )
+  {
+    for( i = 0; i < Scale; i++ )
+    {
+      LCD_WriteStream( *pixels );
+    }
+    pixels++;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_EndWrite
+// Description    : Closes the write session opened by LCD_BeginWrite or
+//                  LCD_BeginWriteColumns.
+void LCD_EndWrite(void)
+{
+  LPC_GPIO0->FIOMASK = 0;
+  LCD_CS(1);
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BlitRGB565
+// Description    : Copies a pre-rendered RGB565 bitmap to the screen in a
+//                  single write session. The bitmap is stored row by row in
+//                  screen orientation and may lie partly off the screen.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: bitmap width in pixels
+//                  - Height: bitmap height in pixels
+//                  - Pixels: Width * Height colors
+void LCD_BlitRGB565(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                    const uint16_t *Pixels)
+{
+  uint16_t i, w = Width, h = Height, skipX, skipY;
+
+  if( !LCD_ClipBlit( &Xpos, &Ypos, &w, &h, &skipX, &skipY ) )
+  {
+    return;
+  }
+  Pixels += (uint32_t)skipY * Width + skipX;
+
+  LCD_BeginWrite( Xpos, Ypos, w, h );
+  if( w == Width )
+  {
+    LCD_WritePixels( Pixels, (uint32_t)w * h );
+  }
+  else
+  {
+    for( i = 0; i < h; i++ )
+    {
+      LCD_WritePixels( Pixels, w );
+      Pixels += Width;
+    }
+  }
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BlitPal4
+// Description    : Copies a 4-bit palettized bitmap to the screen in a single
+//                  write session, expanding each pixel through a 16-entry
+//                  color table. Two pixels per byte, left pixel in the high
+//                  nibble; every row starts on a byte boundary.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: bitmap width in pixels
+//                  - Height: bitmap height in pixels
+//                  - Pixels: (Width + 1) / 2 bytes per row
+//                  - Palette: 16 RGB565 colors
+void LCD_BlitPal4(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                  const uint8_t *Pixels, const uint16_t *Palette)
+{
+  uint16_t i, j, w = Width, h = Height, skipX, skipY;
+  uint16_t stride = ( Width + 1 ) >> 1;
+  const uint8_t *src;
+
+  if( !LCD_ClipBlit( &Xpos, &Ypos, &w, &h, &skipX, &skipY ) )
+  {
+    return;
+  }
+  Pixels += (uint32_t)skipY * stride;
+
+  LCD_BeginWrite( Xpos, Ypos, w, h );
+  for( i = 0; i < h; i++ )
+  {
+    src = Pixels + ( skipX >> 1 );
+    j = w;
+    if( skipX & 1 )
+    {
+      LCD_WriteStream( Palette[ *src++ & 0x0F ] );
+      j--;
+    }
+    for( ; j >= 2; j -= 2 )
+    {
+      LCD_WriteStream( Palette[ *src >> 4 ] );
+      LCD_WriteStream( Palette[ *src++ & 0x0F ] );
+    }
+    if( j )
+    {
+      LCD_WriteStream( Palette[ *src >> 4 ] );
+    }
+    Pixels += stride;
+  }
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_StreamScaled
+// Description    : Streams one screen row of a scaled bitmap: each source
+//                  pixel repeated Scale times, starting part way into the
+//                  first one where the row is clipped on the left
+// Input          : - row: source colors, from the first source pixel of the
+//                    bitmap row
+//                  - skip: screen pixels clipped off the left of the row
+//                  - w: screen pixels to stream
+//                  - Scale: repeats per source pixel
+static void LCD_StreamScaled(const uint16_t *row, uint16_t skip, uint16_t w, uint8_t Scale)
+{
+  uint8_t n = Scale - ( skip % Scale );
+
+  row += skip / Scale;
+  while( w )
+  {
+    if( n > w )
+    {
+      n = (uint8_t)w;
+    }
+    w -= n;
+    while( n-- )
+    {
+      LCD_WriteStream( *row );
+    }
+    row++;
+    n = Scale;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ClipScaled
+// Description    : LCD_ClipBlit for a bitmap enlarged Scale times. The
+//                  enlarged size is worked out in 32 bits and cut at the
+//                  far edge of the clip rectangle first, so that a large
+//                  bitmap or factor cannot wrap the 16-bit sizes into a
+//                  small rectangle; only pixels past that edge are lost.
+// Input          : - Xpos, Ypos: top-left corner, may lie off the screen
+//                  - Width, Height: source size in pixels, replaced by the
+//                    visible enlarged size
+//                  - Scale: 1 or more
+//                  - SkipX, SkipY: clipped enlarged columns and rows
+// Return         : 0 if nothing is visible or Scale is 0
+static uint8_t LCD_ClipScaled(int16_t *Xpos, int16_t *Ypos, uint16_t *Width, uint16_t *Height,
+                              uint8_t Scale, uint16_t *SkipX, uint16_t *SkipY)
+{
+  int32_t w = (int32_t)*Width * Scale, h = (int32_t)*Height * Scale;
+
+  if( Scale == 0 || *Xpos >= LCD_CLIP.x1 || *Ypos >= LCD_CLIP.y1 )
+  {
+    return 0;
+  }
+  if( w > LCD_CLIP.x1 - *Xpos )
+  {
+    w = LCD_CLIP.x1 - *Xpos;
+  }
+  if( h > LCD_CLIP.y1 - *Ypos )
+  {
+    h = LCD_CLIP.y1 - *Ypos;
+  }
+  *Width = (uint16_t)w;
+  *Height = (uint16_t)h;
+  return LCD_ClipBlit( Xpos, Ypos, Width, Height, SkipX, SkipY );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BlitScaled
+// Description    : LCD_BlitRGB565 enlarged by an integer factor in the bus
+//                  stream: each source pixel is repeated Scale times along
+//                  its row and each row is replayed Scale times, all in one
+//                  window, so no enlarged copy of the bitmap is made.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: source width in pixels
+//                  - Height: source height in pixels
+//                  - Pixels: Width * Height colors
+//                  - Scale: 1 or more; the screen size is Scale times the
+//                    source size
+void LCD_BlitScaled(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                    const uint16_t *Pixels, uint8_t Scale)
+{
+  uint16_t i, w = Width, h = Height, skipX, skipY;
+
+  if( !LCD_ClipScaled( &Xpos, &Ypos, &w, &h, Scale, &skipX, &skipY ) )
+  {
+    return;
+  }
+
+  LCD_BeginWrite( Xpos, Ypos, w, h );
+  for( i = skipY; i < skipY + h; i++ )
+  {
+    LCD_StreamScaled( Pixels + (uint32_t)( i / Scale ) * Width, skipX, w, Scale );
+  }
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BlitPal4Scaled
+// Description    : LCD_BlitPal4 enlarged by an integer factor like
+//                  LCD_BlitScaled. Each source row is expanded through the
+//                  palette once and then replayed.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: source width in pixels
+//                  - Height: source height in pixels
+//                  - Pixels: (Width + 1) / 2 bytes per row
+//                  - Palette: 16 RGB565 colors
+//                  - Scale: 1 or more
+void LCD_BlitPal4Scaled(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                        const uint8_t *Pixels, const uint16_t *Palette, uint8_t Scale)
+{
+  uint16_t i, j, first, last, w = Width, h = Height, skipX, skipY;
+  uint16_t stride = ( Width + 1 ) >> 1;
+  const uint8_t *src;
+
+  if( !LCD_ClipScaled( &Xpos, &Ypos, &w, &h, Scale, &skipX, &skipY ) )
+  {
+    return;
+  }
+  // Visible source columns; the screen width bounds them by the buffer size
+  first = skipX / Scale;
+  last = ( skipX + w - 1 ) / Scale;
+
+  LCD_BeginWrite( Xpos, Ypos, w, h );
+  for( i = skipY; i < skipY + h; i++ )
+  {
+    if( i == skipY || ( i % Scale ) == 0 )
+    {
+      src = Pixels + (uint32_t)( i / Scale ) * stride;
+      for( j = first; j <= last; j++ )
+      {
+        LCD_CopyBuffer[ j - first ] = Palette[ ( j & 1 ) ? ( src[ j >> 1 ] & 0x0F ) : ( src[ j >> 1 ] >> 4 ) ];
+      }
+    }
+    LCD_StreamScaled( LCD_CopyBuffer, skipX - first * Scale, w, Scale );
+  }
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_StartRead
+// Description    : Turns the bus towards the CPU for GRAM reads at the
+//                  current address and does the controller's dummy read.
+//                  CS and RS stay asserted until LCD_StopRead.
+static void LCD_StartRead(void)
+{
+  LPC_GPIO2->FIODIR0 = 0x00;                  // P2.0...P2.7 Input 
+  LCD_BusDir = LCD_BUS_IN;
+  LCD_DIR(0);                                 // Interface B->A 
+  LCD_CS(0);
+  LCD_RS(1);
+  LCD_WR(1);
+  (void)LCD_ReadStream();                     // Empty read 
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_StopRead
+// Description    : Ends the reads started by LCD_StartRead. The reads moved
+//                  the address counter, so the cursor model is dropped.
+static void LCD_StopRead(void)
+{
+  LCD_CS(1);
+  LCD_DIR(1);
+  LCD_CurValid = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_GetPoint
+// Description    :
+// Input          : - Xpos: Row Coordinate
+//                  - Xpos: Line Coordinate 
+// Return          : Screen Color
+uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos)
+{
+  uint16_t color;
+
+  LCD_SetCursor(Xpos,Ypos);
+  LCD_OP(BeginGRAMWrite)();
+  LCD_StartRead();
+  LCD_OP(ReadPixels)( &color, 1 );
+  LCD_StopRead();
+  return color;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ReadRect
+// Description    : Reads a rectangle of the screen back in one session: the
+//                  window is programmed once and the address counter walks
+//                  it, so each pixel costs only its read strobe.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - Width: rectangle width in pixels
+//                  - Height: rectangle height in pixels, the rectangle must
+//                    lie entirely on the screen
+//                  - pixels: buffer for Width * Height RGB565 colors, row
+//                    by row
+void LCD_ReadRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pixels)
+{
+  if( Width == 0 || Height == 0 )
+  {
+    return;
+  }
+  LCD_SetWindow( Xpos, Ypos, Xpos + Width - 1, Ypos + Height - 1 );
+  LCD_OP(BeginGRAMWrite)();
+  LCD_StartRead();
+  LCD_OP(ReadPixels)( pixels, (uint32_t)Width * Height );
+  LCD_StopRead();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_CopyRect
+// Description    : Moves a screen area without re-rendering it, reading as
+//                  many whole lines as LCD_COPY_PIXELS holds and writing
+//                  them back in one session each. Overlapping areas are
+//                  copied in the order that never overwrites unread lines.
+//                  The destination is clipped, the source cut to the screen.
+// Input          : - SrcX, SrcY: top-left corner of the area to copy
+//                  - Width, Height: size in pixels
+//                  - DstX, DstY: new top-left corner, may lie off the screen
+void LCD_CopyRect(uint16_t SrcX, uint16_t SrcY, uint16_t Width, uint16_t Height,
+                  int16_t DstX, int16_t DstY)
+{
+  uint16_t skipX, skipY, lines, chunk, first, line;
+
+  if( SrcX >= LCD_Width || SrcY >= LCD_Height )
+  {
+    return;
+  }
+  if( Width > LCD_Width - SrcX )
+  {
+    Width = LCD_Width - SrcX;
+  }
+  if( Height > LCD_Height - SrcY )
+  {
+    Height = LCD_Height - SrcY;
+  }
+  if( !LCD_ClipBlit( &DstX, &DstY, &Width, &Height, &skipX, &skipY ) )
+  {
+    return;
+  }
+  SrcX += skipX;
+  SrcY += skipY;
+  lines = LCD_COPY_PIXELS / Width;
+
+  for( first = 0; first < Height; first += chunk )
+  {
+    chunk = ( Height - first < lines ) ? Height - first : lines;
+    // Moving down: walk up from the bottom lines
+    line = ( DstY > (int16_t)SrcY ) ? Height - first - chunk : first;
+    LCD_ReadRect( SrcX, SrcY + line, Width, chunk, LCD_CopyBuffer );
+    LCD_BeginWrite( DstX, DstY + line, Width, chunk );
+    LCD_WritePixels( LCD_CopyBuffer, (uint32_t)Width * chunk );
+    LCD_EndWrite();
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_ReadScreen
+// Description    : Debug screenshot: reads the screen back line by line and
+//                  hands every line to a sink, e.g. a UART dump. No LCD
+//                  session is open while the sink runs.
+// Input          : - LineOut: called LCD_GetHeight() times with a line of
+//                    LCD_GetWidth() RGB565 colors
+//                    and the line number
+void LCD_ReadScreen(void (*LineOut)(const uint16_t *pixels, uint16_t Width, uint16_t Ypos))
+{
+  uint16_t y;
+
+  for( y = 0; y < LCD_Height; y++ )
+  {
+    LCD_ReadRect( 0, y, LCD_Width, 1, LCD_CopyBuffer );
+    LineOut( LCD_CopyBuffer, LCD_Width, y );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetOrientation
+// Description    : Turns the screen at run time. Only the entry mode and the
+//                  coordinate mapping change, so write sessions keep
+//                  auto-incrementing in every orientation and GRAM keeps
+//                  its content, now seen turned. The clip stack is emptied,
+//                  as its rectangles belong to the old orientation.
+// Input          : - Angle: 0, 90, 180 or 270 degrees clockwise
+// Return         : 0 if the angle is not supported; controllers without
+//                  entry mode support stay at 0
+uint8_t LCD_SetOrientation(uint16_t Angle)
+{
+  uint8_t rotation = (uint8_t)( Angle / 90 ), previous = LCD_Rotation;
+
+  if( ( Angle % 90 ) != 0 || rotation > 3 )
+  {
+    return 0;
+  }
+  LCD_Rotation = rotation;
+  if( !LCD_SetEntry( LCD_ScanEntry( LCD_SCAN_ROWS ) ) )
+  {
+    LCD_Rotation = previous;
+    return 0;
+  }
+  LCD_Width = ( rotation & 1 ) ? LCD_PANEL_Y : LCD_PANEL_X;
+  LCD_Height = ( rotation & 1 ) ? LCD_PANEL_X : LCD_PANEL_Y;
+  LCD_ClipLevel = 0;
+  LCD_CLIP.x0 = 0;
+  LCD_CLIP.y0 = 0;
+  LCD_CLIP.x1 = LCD_Width;
+  LCD_CLIP.y1 = LCD_Height;
+  LCD_CurValid = 0;
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_GetWidth
+// Description    : Screen width in the current orientation
+// Return         : Width in pixels
+uint16_t LCD_GetWidth(void)
+{
+  return LCD_Width;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_GetHeight
+// Description    : Screen height in the current orientation
+// Return         : Height in pixels
+uint16_t LCD_GetHeight(void)
+{
+  return LCD_Height;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetScroll
+// Description    : Hardware vertical scroll of the whole screen: panel line
+//                  y then shows GRAM line (y + Line) mod 320. Drawing still
+//                  addresses GRAM, so after scrolling by n lines only the n
+//                  lines that wrapped around need new content.
+// Input          : - Line: GRAM line shown on the first panel line, 0..319
+// Return         : 0 if the controller cannot scroll
+uint8_t LCD_SetScroll(uint16_t Line)
+{
+  return LCD_OP(SetScroll)( Line % LCD_PANEL_Y );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetPartialImage
+// Description    : Shows GRAM lines Start..Start+Lines-1 as a partial image
+//                  at a fixed panel line, e.g. a status strip that stays
+//                  put while the base image scrolls. The lines are held
+//                  from then on: LCD_Clear and the full-screen flushes built
+//                  on LCD_BaseLines skip them, so only what the owner
+//                  redraws there changes. They stay held on controllers
+//                  without partial display, where they show as part of the
+//                  base image.
+// Input          : - Image: 0 or 1
+//                  - Position: panel line the image starts on
+//                  - Start: first GRAM line of the image
+//                  - Lines: image height, 0 to switch it off and release
+//                    the lines
+// Return         : 0 if the controller cannot show partial images or the
+//                  arguments are out of range
+uint8_t LCD_SetPartialImage(uint8_t Image, uint16_t Position, uint16_t Start, uint16_t Lines)
+{
+  if( ( Image >= LCD_PARTIAL_IMAGES ) || ( Start + Lines > LCD_PANEL_Y ) || ( Position + Lines > LCD_PANEL_Y ) )
+  {
+    return 0;
+  }
+  LCD_PartialStart[ Image ] = Start;
+  LCD_PartialLines[ Image ] = Lines;
+  return LCD_OP(SetPartial)( Image, Position, Start, Lines );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BaseLines
+// Description    : Finds the next run of GRAM lines not held by a partial
+//                  image, for writers that cover the whole screen
+// Input          : - Line: first line to consider
+//                  - Lines: receives the length of the run, 0 if none is left
+// Return         : first line of the run
+uint16_t LCD_BaseLines(uint16_t Line, uint16_t *Lines)
+{
+  uint16_t end = LCD_PANEL_Y;
+  uint8_t i, moved;
+
+  do
+  {
+    moved = 0;
+    for( i = 0; i < LCD_PARTIAL_IMAGES; i++ )
+    {
+      if( ( LCD_PartialLines[i] != 0 ) && ( Line >= LCD_PartialStart[i] ) &&
+          ( Line < LCD_PartialStart[i] + LCD_PartialLines[i] ) )
+      {
+        Line = LCD_PartialStart[i] + LCD_PartialLines[i];
+        moved = 1;
+      }
+    }
+  } while( moved );
+
+  for( i = 0; i < LCD_PARTIAL_IMAGES; i++ )
+  {
+    if( ( LCD_PartialLines[i] != 0 ) && ( LCD_PartialStart[i] > Line ) && ( LCD_PartialStart[i] < end ) )
+    {
+      end = LCD_PartialStart[i];
+    }
+  }
+  *Lines = ( Line < end ) ? end - Line : 0;
+  return Line;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PlotPoint
+// Description    : Writes one pixel with no clipping, for primitives that
+//                  have already clipped their whole extent
+// Input          : - Xpos: Row Coordinate, on the screen
+//                  - Ypos: Line Coordinate, on the screen
+static void LCD_PlotPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
+{
+  LCD_MapPoint( &Xpos, &Ypos );
+  if( LCD_CursorAt( Xpos, Ypos ) )
+  {
+    LCD_WriteData(point);
+  }
+  else
+  {
+    LCD_SetPanelCursor(Xpos,Ypos);
+    LCD_OP(BeginGRAMWrite)();
+    LCD_WriteData(point);
+    LCD_CurValid = 1;
+  }
+  LCD_AdvanceCursor();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetPoint
+// Description    : 
+// Input          : - Xpos: Row Coordinate
+//                  - Ypos: Line Coordinate 
+void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
+{
+  if( (int32_t)Xpos < LCD_CLIP.x0 || (int32_t)Xpos >= LCD_CLIP.x1 ||
+      (int32_t)Ypos < LCD_CLIP.y0 || (int32_t)Ypos >= LCD_CLIP.y1 )
+  {
+    return;
+  }
+  LCD_PlotPoint( Xpos, Ypos, point );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_LineRun
+// Description    : Draws one run of a line: pixels sharing the same minor
+//                  coordinate. Long runs go out as a single window burst,
+//                  short ones as points, which reuse the cursor where the
+//                  controller allows and skip the window setup.
+// Input          : - u: major axis coordinate of the first pixel
+//                  - v: minor axis coordinate of the run
+//                  - len: pixels in the run
+//                  - steep: 1 if the major axis is Y
+//                  - color: RGB565 color
+static void LCD_LineRun(int32_t u, int32_t v, uint32_t len, uint8_t steep, uint16_t color)
+{
+  if( len >= LCD_LINE_RUN_MIN )
+  {
+    if( steep )
+    {
+      LCD_BeginWrite( v, u, 1, len );
+    }
+    else
+    {
+      LCD_BeginWrite( u, v, len, 1 );
+    }
+    LCD_WriteRepeat( color, len );
+    LCD_EndWrite();
+    return;
+  }
+  while( len-- )
+  {
+    if( steep )
+    {
+      LCD_PlotPoint( v, u++, color );
+    }
+    else
+    {
+      LCD_PlotPoint( u++, v, color );
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_DrawLine
+// Description    : Bresenham's line algorithm, all octants, both end points
+//                  drawn. The line is walked along its major axis in the
+//                  increasing direction and cut to the clip rectangle
+//                  analytically: the first and last visible steps and the
+//                  error term at the first are computed, not iterated.
+//                  Pixels sharing a row (or column, for steep lines) are
+//                  emitted together by LCD_LineRun.
+// Input          : - x0, y0: one end point, read as signed
+//                  - x1, y1: the other end point
+//                  - color: RGB565 color
+void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color)
+{
+  int32_t u0, v0, u1, v1, cu0, cu1, cv0, cv1;
+  int32_t du, dv, sv, k, kEnd, n, D, start, mLo, mHi;
+  uint8_t steep;
+
+  u0 = (int16_t)x0;  v0 = (int16_t)y0;
+  u1 = (int16_t)x1;  v1 = (int16_t)y1;
+  steep = ( ( v1 > v0 ? v1 - v0 : v0 - v1 ) > ( u1 > u0 ? u1 - u0 : u0 - u1 ) );
+  if( steep )
+  {
+    k = u0;  u0 = v0;  v0 = k;
+    k = u1;  u1 = v1;  v1 = k;
+    cu0 = LCD_CLIP.y0;  cu1 = LCD_CLIP.y1;
+    cv0 = LCD_CLIP.x0;  cv1 = LCD_CLIP.x1;
+  }
+  else
+  {
+    cu0 = LCD_CLIP.x0;  cu1 = LCD_CLIP.x1;
+    cv0 = LCD_CLIP.y0;  cv1 = LCD_CLIP.y1;
+  }
+  if( u0 > u1 )
+  {
+    k = u0;  u0 = u1;  u1 = k;
+    k = v0;  v0 = v1;  v1 = k;
+  }
+  du = u1 - u0;
+  dv = ( v1 > v0 ) ? v1 - v0 : v0 - v1;
+  sv = ( v1 >= v0 ) ? 1 : -1;
+
+  // Visible steps along the major axis
+  k = ( cu0 > u0 ) ? cu0 - u0 : 0;
+  kEnd = ( cu1 - 1 - u0 < du ) ? cu1 - 1 - u0 : du;
+
+  // Visible minor steps taken: after k major steps the line has moved
+  // n(k) = (2*dv*k + du - 1) / (2*du) along the minor axis
+  mLo = ( sv > 0 ) ? cv0 - v0 : v0 - ( cv1 - 1 );
+  mHi = ( sv > 0 ) ? cv1 - 1 - v0 : v0 - cv0;
+  if( mHi < 0 || ( dv == 0 && mLo > 0 ) )
+  {
+    return;
+  }
+  if( dv != 0 )
+  {
+    if( mLo > 0 )
+    {
+      start = (int32_t)( ( 2 * (int64_t)du * mLo - du + 2 * dv ) / ( 2 * dv ) );
+      if( start > k )
+      {
+        k = start;
+      }
+    }
+    start = (int32_t)( ( 2 * (int64_t)du * ( mHi + 1 ) - du ) / ( 2 * dv ) );
+    if( start < kEnd )
+    {
+      kEnd = start;
+    }
+  }
+  if( k > kEnd )
+  {
+    return;
+  }
+
+  n = ( du == 0 ) ? 0 : (int32_t)( ( 2 * (int64_t)dv * k + du - 1 ) / ( 2 * du ) );
+  D = (int32_t)( 2 * (int64_t)dv * ( k + 1 ) - du - 2 * (int64_t)du * n );
+  for( start = k; k <= kEnd; k++ )
+  {
+    if( D > 0 || k == kEnd )
+    {
+      LCD_LineRun( u0 + start, v0 + sv * n, k - start + 1, steep, color );
+      start = k + 1;
+      if( D > 0 )
+      {
+        n++;
+        D -= 2 * du;
+      }
+    }
+    D += 2 * dv;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetTextMode
+// Description    : Chooses how LCD_PutChar and LCD_PutText draw: opaque
+//                  cells that also paint the background, or transparent
+//                  ones that only draw the foreground pixels
+// Input          : - Mode: LCD_TEXT_OPAQUE or LCD_TEXT_TRANSPARENT
+void LCD_SetTextMode(uint8_t Mode)
+{
+  LCD_TextMode = Mode;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_SetFont
+// Description    : Chooses the font of LCD_PutChar and LCD_PutText: one of
+//                  the fonts of a blob built by tools/fontc.py, or the
+//                  fixed 8x16 AsciiLib font
+// Input          : - Blob: font blob, NULL for the AsciiLib font
+//                  - Index: font number in the blob
+// Return         : 0 if the blob has no such font; the font is unchanged
+uint8_t LCD_SetFont(const uint8_t *Blob, uint8_t Index)
+{
+  if( Blob == NULL )
+  {
+    LCD_Font = NULL;
+    return 1;
+  }
+  if( Index >= Blob[0] )
+  {
+    return 0;
+  }
+  LCD_Font = Blob + ( Blob[ 1 + 2 * Index ] | ( Blob[ 2 + 2 * Index ] << 8 ) );
+  return 1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_FontGlyph
+// Description    : Finds a glyph of the current blob font
+// Input          : - Code: character code
+//                  - End: set to one past the last byte of the glyph
+// Return         : the glyph, its advance width first, or NULL if the font
+//                  has no glyph for the code
+static const uint8_t *LCD_FontGlyph(uint8_t Code, const uint8_t **End)
+{
+  const uint8_t *index;
+
+  if( Code < LCD_Font[1] || Code > LCD_Font[2] )
+  {
+    return NULL;
+  }
+  index = LCD_Font + 4 + 2 * ( Code - LCD_Font[1] );
+  *End = LCD_Font + ( index[2] | ( index[3] << 8 ) );
+  return LCD_Font + ( index[0] | ( index[1] << 8 ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_GlyphWidth
+// Description    : Advance width of a character in the current font
+// Input          : - Code: character code
+// Return         : width in pixels; 0 for codes a blob font has no glyph for
+static uint16_t LCD_GlyphWidth(uint8_t Code)
+{
+  const uint8_t *glyph, *end;
+
+  if( LCD_Font == NULL )
+  {
+    return ASCII_WIDTH;
+  }
+  glyph = LCD_FontGlyph( Code, &end );
+  return ( glyph != NULL ) ? glyph[0] : 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_TextWidth
+// Description    : Measures a string in the current font, as LCD_PutText
+//                  draws it on one line
+// Input          : - str: zero terminated string
+// Return         : width in pixels
+uint16_t LCD_TextWidth(const uint8_t *str)
+{
+  uint16_t width = 0;
+
+  while( *str != 0 )
+  {
+    width += LCD_GlyphWidth( *str++ );
+  }
+  return width;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_FontHeight
+// Description    : Height of the text lines of the current font
+// Return         : height in pixels
+uint16_t LCD_FontHeight(void)
+{
+  return ( LCD_Font != NULL ) ? LCD_Font[0] : ASCII_HEIGHT;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_BlendColors
+// Description    : Finds the blend table of a color pair in the cache, or
+//                  builds it in place of the least recently used one, so
+//                  anti-aliased pixels cost a table lookup
+// Input          : - fg, bg: RGB565 colors
+// Return         : 16 colors, from bg at coverage 0 to fg at 15
+static const uint16_t *LCD_BlendColors(uint16_t fg, uint16_t bg)
+{
+  uint8_t k, e, a;
+  LCD_BlendTable *table;
+
+  for( k = 0; k < LCD_BlendUsed; k++ )
+  {
+    table = &LCD_BlendCache[ LCD_BlendOrder[k] ];
+    if( table->fg == fg && table->bg == bg )
+    {
+      break;
+    }
+  }
+  if( k == LCD_BlendUsed )
+  {
+    if( LCD_BlendUsed < LCD_BLEND_CACHE )
+    {
+      LCD_BlendOrder[k] = k;
+      LCD_BlendUsed++;
+    }
+    else
+    {
+      k--;
+    }
+    table = &LCD_BlendCache[ LCD_BlendOrder[k] ];
+    table->fg = fg;
+    table->bg = bg;
+    for( a = 0; a < 16; a++ )
+    {
+      table->lut[a] = (uint16_t)(
+        ( ( ( ( fg >> 11 ) * a + ( bg >> 11 ) * ( 15 - a ) + 7 ) / 15 ) << 11 ) |
+        ( ( ( ( ( fg >> 5 ) & 0x3F ) * a + ( ( bg >> 5 ) & 0x3F ) * ( 15 - a ) + 7 ) / 15 ) << 5 ) |
+          ( ( ( fg & 0x1F ) * a + ( bg & 0x1F ) * ( 15 - a ) + 7 ) / 15 ) );
+    }
+  }
+  e = LCD_BlendOrder[k];
+  for( ; k > 0; k-- )
+  {
+    LCD_BlendOrder[k] = LCD_BlendOrder[ k - 1 ];
+  }
+  LCD_BlendOrder[0] = e;
+  return LCD_BlendCache[e].lut;
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutFontGlyphs
+// Description    : LCD_PutGlyphs for a blob font. The glyphs are stored
+//                  column by column as background and foreground runs, so
+//                  opaque text is decoded straight into one column-order
+//                  window burst for the whole run, each run a single
+//                  repeat. Transparent text sends the foreground runs as
+//                  vertical spans. Controllers that cannot scan columns
+//                  get the background filled first and the foreground as
+//                  spans. Anti-aliased runs take their color from the
+//                  blend table of the color pair; in transparent mode the
+//                  covered pixels are blended against bkColor, taken as
+//                  the color underneath. Codes without a glyph are skipped.
+// Input          : - Xpos, Ypos: top-left corner of the first glyph
+//                  - str: characters
+//                  - count: characters in the run
+//                  - charColor, bkColor: RGB565 colors
+static void LCD_PutFontGlyphs(int16_t Xpos, int16_t Ypos, const uint8_t *str, uint16_t count,
+                              uint16_t charColor, uint16_t bkColor)
+{
+  uint16_t w = 0, h = LCD_Font[0], skipX, skipY, col, row, len, n, y0, y1, i, color;
+  uint8_t fgBits = LCD_Font[3], half, ink, columns = 0;
+  const uint8_t *glyph, *end;
+  const uint16_t *lut = NULL;
+
+  for( i = 0; i < count; i++ )
+  {
+    w += LCD_GlyphWidth( str[i] );
+  }
+  if( !LCD_ClipBlit( &Xpos, &Ypos, &w, &h, &skipX, &skipY ) )
+  {
+    return;
+  }
+
+  if( fgBits == 0 )
+  {
+    lut = LCD_BlendColors( charColor, bkColor );
+  }
+  if( LCD_TextMode == LCD_TEXT_OPAQUE )
+  {
+    columns = LCD_BeginWriteColumns( Xpos, Ypos, w, h );
+    if( !columns )
+    {
+      LCD_FillRect( Xpos, Ypos, w, h, bkColor );
+    }
+  }
+  col = 0;
+  for( i = 0; i < count && col < skipX + w; i++ )
+  {
+    glyph = LCD_FontGlyph( str[i], &end );
+    if( glyph == NULL )
+    {
+      continue;
+    }
+    if( col + glyph[0] <= skipX )
+    {
+      col += glyph[0];
+      continue;
+    }
+    row = 0;
+    for( glyph++; glyph < end; glyph++ )
+    {
+      // A byte holds a background and a foreground run, or a single
+      // anti-aliased one
+      for( half = ( lut != NULL ); half < 2; half++ )
+      {
+        if( lut != NULL )
+        {
+          len = ( *glyph & 0x0F ) + 1;
+          color = lut[ *glyph >> 4 ];
+          ink = ( *glyph >> 4 ) != 0;
+        }
+        else
+        {
+          len = half ? ( *glyph & ( ( 1 << fgBits ) - 1 ) ) : ( *glyph >> fgBits );
+          color = half ? charColor : bkColor;
+          ink = half;
+        }
+        while( len )
+        {
+          // Part of the run in this column, cut to the visible rows
+          n = ( len < LCD_Font[0] - row ) ? len : LCD_Font[0] - row;
+          y0 = ( row > skipY ) ? row : skipY;
+          y1 = ( row + n < skipY + h ) ? row + n : skipY + h;
+          if( col >= skipX && col < skipX + w && y0 < y1 )
+          {
+            if( columns )
+            {
+              LCD_WriteRepeat( color, y1 - y0 );
+            }
+            else if( ink )
+            {
+              LCD_LineRun( Ypos + ( y0 - skipY ), Xpos + ( col - skipX ), y1 - y0, 1, color );
+            }
+          }
+          len -= n;
+          row += n;
+          if( row == LCD_Font[0] )
+          {
+            row = 0;
+            col++;
+          }
+        }
+      }
+    }
+  }
+  if( columns )
+  {
+    LCD_EndWrite();
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutGlyphs
+// Description    : Draws a run of characters side by side on one text line.
+//                  Opaque text goes out as a single window burst for the
+//                  whole run, row by row across the glyphs; transparent
+//                  text as the foreground spans of each row, which may
+//                  cross glyph edges. Codes without a glyph are blank.
+//                  Blob fonts are handed to LCD_PutFontGlyphs.
+// Input          : - Xpos, Ypos: top-left corner of the first cell
+//                  - str: characters
+//                  - count: characters in the run
+//                  - charColor, bkColor: RGB565 colors
+static void LCD_PutGlyphs(int16_t Xpos, int16_t Ypos, const uint8_t *str, uint16_t count,
+                          uint16_t charColor, uint16_t bkColor)
+{
+  uint16_t w = count * ASCII_WIDTH, h = ASCII_HEIGHT, skipX, skipY, row, col, span;
+  const unsigned char *glyph;
+  uint8_t bits = 0;
+
+  if( LCD_Font != NULL )
+  {
+    LCD_PutFontGlyphs( Xpos, Ypos, str, count, charColor, bkColor );
+    return;
+  }
+  if( !LCD_ClipBlit( &Xpos, &Ypos, &w, &h, &skipX, &skipY ) )
+  {
+    return;
+  }
+
+  if( LCD_TextMode == LCD_TEXT_OPAQUE )
+  {
+    LCD_BeginWrite( Xpos, Ypos, w, h );
+  }
+  for( row = skipY; row < skipY + h; row++ )
+  {
+    span = skipX + w;
+    for( col = skipX; col < skipX + w; col++ )
+    {
+      if( col == skipX || ( col % ASCII_WIDTH ) == 0 )
+      {
+        glyph = GetASCIIGlyph( str[ col / ASCII_WIDTH ] );
+        bits = ( glyph != NULL ) ? (uint8_t)( glyph[row] << ( col % ASCII_WIDTH ) ) : 0;
+      }
+      if( LCD_TextMode == LCD_TEXT_OPAQUE )
+      {
+        LCD_WriteStream( ( bits & 0x80 ) ? charColor : bkColor );
+      }
+      else if( bits & 0x80 )
+      {
+        if( span == skipX + w )
+        {
+          span = col;
+        }
+      }
+      else if( span != skipX + w )
+      {
+        LCD_LineRun( Xpos + ( span - skipX ), Ypos + ( row - skipY ), col - span, 0, charColor );
+        span = skipX + w;
+      }
+      bits <<= 1;
+    }
+    if( span != skipX + w )
+    {
+      LCD_LineRun( Xpos + ( span - skipX ), Ypos + ( row - skipY ), col - span, 0, charColor );
+    }
+  }
+  if( LCD_TextMode == LCD_TEXT_OPAQUE )
+  {
+    LCD_EndWrite();
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutChar
+// Description    : Draws one character in the text mode and font
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - ASCI: character code; codes without a glyph are blank
+//                  - charColor: foreground color
+//                  - bkColor: background color; in transparent mode only
+//                    blended into the edges of anti-aliased fonts
+void LCD_PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor)
+{
+  LCD_PutGlyphs( (int16_t)Xpos, (int16_t)Ypos, &ASCI, 1, charColor, bkColor );
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutCharScaled
+// Description    : Draws one AsciiLib character enlarged by an integer
+//                  factor, e.g. for titles. Opaque cells go out as one
+//                  window with each glyph row expanded once and replayed
+//                  Scale times; transparent ones as a filled block per
+//                  foreground span.
+// Input          : - Xpos: Row Coordinate of the top-left corner
+//                  - Ypos: Line Coordinate of the top-left corner
+//                  - ASCI: character code; codes without a glyph are blank
+//                  - charColor: foreground color
+//                  - bkColor: background color, unused in transparent mode
+//                  - Scale: 1 or more; the cell is 8 * Scale by 16 * Scale
+void LCD_PutCharScaled(uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor,
+                       uint16_t bkColor, uint8_t Scale)
+{
+  int16_t x = (int16_t)Xpos, y = (int16_t)Ypos;
+  uint16_t w = ASCII_WIDTH, h = ASCII_HEIGHT, skipX, skipY, row, col, span;
+  const unsigned char *glyph = GetASCIIGlyph( ASCI );
+  uint8_t bits;
+
+  if( Scale == 0 )
+  {
+    return;
+  }
+  if( LCD_TextMode == LCD_TEXT_TRANSPARENT )
+  {
+    for( row = 0; glyph != NULL && row < ASCII_HEIGHT; row++ )
+    {
+      span = ASCII_WIDTH;
+      for( col = 0; col <= ASCII_WIDTH; col++ )
+      {
+        bits = ( col < ASCII_WIDTH ) ? (uint8_t)( glyph[row] << col ) : 0;
+        if( bits & 0x80 )
+        {
+          if( span == ASCII_WIDTH )
+          {
+            span = col;
+          }
+        }
+        else if( span != ASCII_WIDTH )
+        {
+          LCD_FillRect( Xpos + span * Scale, Ypos + row * Scale, ( col - span ) * Scale, Scale, charColor );
+          span = ASCII_WIDTH;
+        }
+      }
+    }
+    return;
+  }
+
+  if( !LCD_ClipScaled( &x, &y, &w, &h, Scale, &skipX, &skipY ) )
+  {
+    return;
+  }
+  LCD_BeginWrite( x, y, w, h );
+  for( row = skipY; row < skipY + h; row++ )
+  {
+    if( row == skipY || ( row % Scale ) == 0 )
+    {
+      bits = ( glyph != NULL ) ? glyph[ row / Scale ] : 0;
+      for( col = 0; col < ASCII_WIDTH; col++ )
+      {
+        LCD_CopyBuffer[col] = ( bits & ( 0x80 >> col ) ) ? charColor : bkColor;
+      }
+    }
+    LCD_StreamScaled( LCD_CopyBuffer, skipX, w, Scale );
+  }
+  LCD_EndWrite();
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutChars
+// Description    : Draws characters side by side on one text line, without
+//                  wrapping, as a single run; e.g. for fields that change
+//                  a few characters at a time. Always opaque 8x16 AsciiLib
+//                  cells, whatever font and text mode are set, so that a
+//                  character's cell does not depend on its neighbours and
+//                  redrawing it replaces the old one.
+// Input          : - Xpos: Row Coordinate of the first cell
+//                  - Ypos: Line Coordinate of the first cell
+//                  - str: characters, need not be zero terminated
+//                  - count: number of characters
+//                  - Color: foreground color
+//                  - bkColor: background color
+void LCD_PutChars(uint16_t Xpos, uint16_t Ypos, const uint8_t *str, uint16_t count,
+                  uint16_t Color, uint16_t bkColor)
+{
+  const uint8_t *font = LCD_Font;
+  uint8_t mode = LCD_TextMode;
+
+  if( count != 0 )
+  {
+    LCD_Font = NULL;
+    LCD_TextMode = LCD_TEXT_OPAQUE;
+    LCD_PutGlyphs( (int16_t)Xpos, (int16_t)Ypos, str, count, Color, bkColor );
+    LCD_Font = font;
+    LCD_TextMode = mode;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Function Name  : LCD_PutText
+// Description    : Draws a string, wrapping to the next text line after the
+//                  glyph that reaches the right edge and to the top after
+//                  the bottom line. Each run of characters on a line is
+//                  drawn in one go by LCD_PutGlyphs.
+// Input          : - Xpos: Row Coordinate of the first cell
+//                  - Ypos: Line Coordinate of the first cell
+//                  - str: zero terminated string
+//                  - Color: foreground color
+//                  - bkColor: background color; in transparent mode only
+//                    blended into the edges of anti-aliased fonts
+void LCD_PutText(uint16_t Xpos, uint16_t Ypos, uint8_t *str, uint16_t Color, uint16_t bkColor)
+{
+  uint16_t count, width, height = LCD_FontHeight();
+
+  while( *str != 0 )
+  {
+    // A run ends with the string or where the next glyph would start off
+    // the right edge
+    count = 1;
+    width = LCD_GlyphWidth( str[0] );
+    while( str[count] != 0 && Xpos + width < LCD_Width )
+    {
+      width += LCD_GlyphWidth( str[count++] );
+    }
+    LCD_PutGlyphs( (int16_t)Xpos, (int16_t)Ypos, str, count, Color, bkColor );
+    str += count;
+    Xpos += width;
+    if( Xpos >= LCD_Width )
+    {
+      Xpos = 0;
+      Ypos = ( Ypos < LCD_Height - height ) ? Ypos + height : 0;
+    }
+  }
+}
+
+/*******************************************************************************
+* Draw Bargraph                                                                *
+*   Parameter:      x:        horizontal position                              *
+*                   y:        vertical position                                *
+*                   w:        maximum width of bargraph (in pixels)            *
+*                   h:        bargraph height                                  *
+*                   val:      value of active bargraph (in 1/1024)             *
+*   Return:                                                                    *
+*******************************************************************************/
+
+void LCD_DrawBargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int h, 
+  unsigned int val, uint16_t barColor, uint16_t bkColor) 
+{
+  // Note: this is taken from the GLCD file of the MCB1700 board;
+  unsigned int i,j;
+  int16_t cx = (int16_t)x, cy = (int16_t)y;
+  uint16_t vw = (uint16_t)w, vh = (uint16_t)h, skipX, skipY;
+
+  if( !LCD_ClipBlit( &cx, &cy, &vw, &vh, &skipX, &skipY ) )
+  {
+    return;
+  }
+  val = (val * w) >> 10; // scale value;
+
+  LCD_BeginWrite( cx, cy, vw, vh );
+  for (i = 0; i < vh; i++) {
+    for (j = skipX; j < skipX + vw; j++) {
       if (j >= val) {
-        LCD_SetPoint( x+j, y+i, bkColor); 
+        LCD_WriteStream( bkColor ); 
       } else {
-        LCD_SetPoint( x+j, y+i, barColor); 
+        LCD_WriteStream( barColor ); 
       }
     }
   }
+  LCD_EndWrite();
 }
@@ -38,7 +38,58 @@
 #define LCD_WR(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_WR) : (LPC_GPIO0->FIOCLR = PIN_WR));
 #define LCD_RD(x)   ((x) ? (LPC_GPIO0->FIOSET = PIN_RD) : (LPC_GPIO0->FIOCLR = PIN_RD));
 
-#define DISP_ORIENTATION  0 // angle 0 90
+// Rotation needs entry-mode support: the HX8346A and HX8347 have none here
+// and stay at 0 degrees, LCD_SetOrientation returning 0 for other angles
+#define DISP_ORIENTATION  0 // angle 0 90 180 270 at init, see LCD_SetOrientation
+
+// Nesting depth of LCD_PushClip, the whole-screen level included
+#ifndef LCD_CLIP_DEPTH
+#define LCD_CLIP_DEPTH  8
+#endif
+
+// Read access wait in wait_delay loops, D8..D15 sampled after RD falls
+#ifndef LCD_READ_ACCESS_DELAY
+#define LCD_READ_ACCESS_DELAY  15
+#endif
+
+// Buffer of LCD_CopyRect and LCD_ReadScreen, at least one screen line
+#ifndef LCD_COPY_PIXELS
+#define LCD_COPY_PIXELS  512
+#endif
+
+// Shortest line run drawn as a window burst instead of points; a window
+// costs about as much as two isolated points
+#ifndef LCD_LINE_RUN_MIN
+#define LCD_LINE_RUN_MIN  4
+#endif
+
+// Foreground/background pairs whose anti-aliasing blend tables are kept
+#ifndef LCD_BLEND_CACHE
+#define LCD_BLEND_CACHE  4
+#endif
+
+// Period of the ms clock given to LCD_PollInitialization. Each init delay is
+// padded by it, as the clock may tick just after the delay began
+#ifndef LCD_INIT_TICK_MS
+#define LCD_INIT_TICK_MS  1
+#endif
+
+// Text modes of LCD_PutChar and LCD_PutText
+#define LCD_TEXT_OPAQUE       0
+#define LCD_TEXT_TRANSPARENT  1
+
+// LCD_SetFont reads font blobs built by tools/fontc.py:
+//   [font count] [offset of each font, 16 bits]
+//   font:  [height] [first code] [last code] [foreground run bits]
+//          [offset of each glyph and one past the last, 16 bits]
+//   glyph: [advance] then bytes of a background run (high bits) and a
+//          foreground run (low bits), column by column, top to bottom
+// Offsets are little endian, from the start of the blob or the font.
+// Anti-aliased fonts have 0 foreground run bits; their glyph bytes are
+// runs of 4-bit coverage (high nibble) and length minus one (low nibble).
+
+// Partial images of the controller, used for fixed status strips
+#define LCD_PARTIAL_IMAGES  2
 
 #if   ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
 #define  MAX_X  320
@@ -77,13 +128,53 @@
 // Private function prototypes
 
 void LCD_Initialization(void);
+void LCD_StartInitialization(uint32_t Now);
+uint8_t LCD_PollInitialization(uint32_t Now);
 void LCD_Clear(uint16_t Color);
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color);
+
+uint8_t LCD_PushClip(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_PopClip(void);
+uint8_t LCD_ClipContains(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height);
+
+void LCD_BeginWrite(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+uint8_t LCD_BeginWriteColumns(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_WritePixels(const uint16_t *pixels, uint32_t count);
+void LCD_WriteRepeat(uint16_t Color, uint32_t count);
+void LCD_WriteScaled(const uint16_t *pixels, uint32_t count, uint8_t Scale);
+void LCD_EndWrite(void);
+void LCD_BlitRGB565(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                    const uint16_t *Pixels);
+void LCD_BlitPal4(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                  const uint8_t *Pixels, const uint16_t *Palette);
+void LCD_BlitScaled(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                    const uint16_t *Pixels, uint8_t Scale);
+void LCD_BlitPal4Scaled(int16_t Xpos, int16_t Ypos, uint16_t Width, uint16_t Height,
+                        const uint8_t *Pixels, const uint16_t *Palette, uint8_t Scale);
 
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
+void LCD_ReadRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t *pixels);
+void LCD_CopyRect(uint16_t SrcX, uint16_t SrcY, uint16_t Width, uint16_t Height,
+                  int16_t DstX, int16_t DstY);
+void LCD_ReadScreen(void (*LineOut)(const uint16_t *pixels, uint16_t Width, uint16_t Ypos));
+uint8_t LCD_SetOrientation(uint16_t Angle);
+uint16_t LCD_GetWidth(void);
+uint16_t LCD_GetHeight(void);
+uint8_t LCD_SetScroll(uint16_t Line);
+uint8_t LCD_SetPartialImage(uint8_t Image, uint16_t Position, uint16_t Start, uint16_t Lines);
+uint16_t LCD_BaseLines(uint16_t Line, uint16_t *Lines);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
 
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color);
+void LCD_SetTextMode(uint8_t Mode);
+uint8_t LCD_SetFont(const uint8_t *Blob, uint8_t Index);
+uint16_t LCD_TextWidth(const uint8_t *str);
+uint16_t LCD_FontHeight(void);
 void LCD_PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor);
+void LCD_PutCharScaled(uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor,
+                       uint16_t bkColor, uint8_t Scale);
+void LCD_PutChars(uint16_t Xpos, uint16_t Ypos, const uint8_t *str, uint16_t count,
+                  uint16_t Color, uint16_t bkColor);
 void LCD_PutText(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor);
 
 void LCD_DrawBargraph (unsigned int x, unsigned int y, unsigned int w, unsigned int h, 
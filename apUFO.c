@@ -24,11 +24,71 @@
 #include "bspHardwareAbstractionLayer.h"
 #include "bspDataTypes.h"
 #include "apUFO.h"
+#include "bspTileMap.h"
+#include "bspFrameBuffer.h"
+#include "bspDisplayList.h"
+#include "bspDirtyRect.h"
+#include "gen_sprites.h"
 
 /* -- DEFINES and ENUMS -- */
-
+#define CELL_SIZE 8 /* UFO and grenade geometry is built from 8x8 cells */
+
+#define UFO_SLOT        0   /* Grenade n is drawn from sprite slot n */
+#define SPRITE_SLOTS    4
+#ifndef MAX_ERASE_RECTS
+#define MAX_ERASE_RECTS 16  /* Pieces kept while subtracting footprints */
+#endif
+
+/* Rendering modes of scRefreshLCDCallback */
+#define RENDER_SPRITES  0   /* Old sprite footprints erased, sprites redrawn */
+#define RENDER_TILEMAP  1   /* Sprites stamped into the cell tile map, changed cells flushed */
+#define RENDER_FRAMEBUFFER 2 /* Sprites painted into the low resolution framebuffer, all flushed */
+#define RENDER_DISPLAYLIST 3 /* Sprites recorded in a display list, rendered in bands */
+#define RENDER_DIRTYRECT 4  /* Sprites painted into the framebuffer, changed areas flushed */
+#define RENDER_SCROLL   5   /* Terrain scrolled by the controller, sprites drawn over it */
+
+#ifndef UFO_RENDER_MODE
+#define UFO_RENDER_MODE RENDER_TILEMAP
+#endif
+#if (UFO_RENDER_MODE < RENDER_SPRITES) || (UFO_RENDER_MODE > RENDER_SCROLL)
+#error "UFO_RENDER_MODE must be one of the RENDER_ modes"
+#endif
+
+/* Scrolling world of RENDER_SCROLL. The controller scrolls along the
+   display's Y axis, which is the landscape X axis, so the world moves
+   sideways; world column n lives on GRAM line n mod SCROLL_LINES */
+#define SCROLL_LINES    X_MAX
+#define SCROLL_STEP     2   /* World columns scrolled in per frame */
+#define TERRAIN_SEGMENT 32  /* World columns between terrain height samples */
+#define TERRAIN_SAMPLES 16
+#define SKY_COLOR       BLACK
+#define GROUND_COLOR    GREEN
 
 /* -- TYPEDEFS and STRUCTURES -- */
+/* Rectangle in display coordinates, X1 and Y1 exclusive. Signed, so that a
+   sprite hanging off the top or left edge still compares correctly */
+typedef struct
+{
+    SDWORD sdwX0;
+    SDWORD sdwY0;
+    SDWORD sdwX1;
+    SDWORD sdwY1;
+} RECT_T;
+
+/* A sprite on the display: where it goes this frame and where it was drawn */
+typedef struct
+{
+    const SPRITE_T *psSprite;
+    void (*pfnDrawCompiled)(WORD wX, WORD wY);
+    const BYTE *pbyCells;       /* Cell map for the tile map */
+    BYTE byCellColumns;
+    BYTE byCellRows;
+    WORD wX;
+    WORD wY;
+    WORD wLastX;
+    WORD wLastY;
+    BOOL fDrawn;
+} SPRITE_SLOT_T;
 
 
 /* -- STATIC AND GLOBAL VARIABLES -- */
@@ -43,13 +103,43 @@ static WORD scwGrenade3y;
 static BOOL scfGrenade1Ready;
 static BOOL scfGrenade2Ready;
 static BOOL scfGrenade3Ready;
+static SPRITE_SLOT_T scasSlots[SPRITE_SLOTS];
+static BOOL scfSceneChanged;    /* Next refresh clears the whole display */
+#if (UFO_RENDER_MODE == RENDER_SCROLL)
+static DWORD scdwCameraX;       /* World column at the left screen edge */
+
+/* Terrain heights in pixels, interpolated between samples, repeating */
+static const BYTE scabyTerrainHeight[TERRAIN_SAMPLES] =
+{
+    24, 40, 56, 48, 32, 20, 28, 60, 72, 52, 36, 24, 44, 64, 40, 28
+};
+#endif
 
 /* -- STATIC FUNCTION PROTOTYPES -- */
 
 /* Callback registration function that registers functions that are called on UFO_EVENT_E events in hardware */
 static BOOL scfRegisterCallback (const pfnEventCallback pfnCallback, const UFO_EVENT_E keEvent);
-static void scDisplayUFO (WORD wXPos, WORD wYPos);
-static void scDisplayGrenade (WORD wXPos, WORD wYPos);
+static void scPlaceUFO (WORD wXPos, WORD wYPos);
+static void scPlaceGrenade (BYTE bySlot, WORD wXPos, WORD wYPos);
+#if (UFO_RENDER_MODE == RENDER_SPRITES)
+static void scDrawSprite (WORD wX, WORD wY, const SPRITE_T *psSprite,
+                          void (*pfnDrawCompiled)(WORD wX, WORD wY));
+static void scEraseUncovered (const SPRITE_SLOT_T *psSlot);
+static void scRunRect (RECT_T *psRect, const SPRITE_RUN_T *psRun, WORD wX, WORD wY);
+static BYTE scbySubtractRect (RECT_T *pasPieces, BYTE byCount, const RECT_T *psCover);
+#endif
+#if (UFO_RENDER_MODE == RENDER_TILEMAP)
+static void scStampSlot (const SPRITE_SLOT_T *psSlot, WORD wX, WORD wY, BOOL fErase);
+#endif
+#if (UFO_RENDER_MODE == RENDER_FRAMEBUFFER) || (UFO_RENDER_MODE == RENDER_DIRTYRECT)
+static void scPaintSlot (const SPRITE_SLOT_T *psSlot);
+#endif
+#if (UFO_RENDER_MODE == RENDER_SCROLL)
+static WORD scwTerrainHeight (DWORD dwWorldX);
+static void scDrawTerrain (DWORD dwWorldX, WORD wX0, WORD wX1);
+static void scRestoreTerrain (WORD wX, WORD wY, WORD wWidth, WORD wHeight);
+static void scDrawScrolledSprite (WORD wX, WORD wY, const SPRITE_T *psSprite);
+#endif
 
 static void scRefreshLCDCallback(void);
 static void scGrenadeCallback(void);
@@ -75,6 +165,7 @@ static void scUFORightCallback(void);
  *----------------------------------------------------------------------------*/
 void InitUFOApp (void)
 {
+    BYTE bySlot;
 
     /* Initialize static and globals */
     scwUFOx = X_MAX/2;
@@ -89,6 +180,22 @@ void InitUFOApp (void)
     scfGrenade2Ready = TRUE;
     scfGrenade3Ready = TRUE;
 
+    for (bySlot = 0; bySlot < SPRITE_SLOTS; bySlot++)
+    {
+        scasSlots[bySlot].psSprite = &gsGrenadeSprite;
+        scasSlots[bySlot].pfnDrawCompiled = DrawGrenadeSprite;
+        scasSlots[bySlot].pbyCells = gabyGrenadeCells;
+        scasSlots[bySlot].byCellColumns = GRENADE_CELL_COLUMNS;
+        scasSlots[bySlot].byCellRows = GRENADE_CELL_ROWS;
+        scasSlots[bySlot].fDrawn = FALSE;
+    }
+    scasSlots[UFO_SLOT].psSprite = &gsUFOSprite;
+    scasSlots[UFO_SLOT].pfnDrawCompiled = DrawUFOSprite;
+    scasSlots[UFO_SLOT].pbyCells = gabyUFOCells;
+    scasSlots[UFO_SLOT].byCellColumns = UFO_CELL_COLUMNS;
+    scasSlots[UFO_SLOT].byCellRows = UFO_CELL_ROWS;
+    scfSceneChanged = TRUE;
+
     /* Setup the hardware */
     if (!fHALSetup())
     {
@@ -152,16 +259,154 @@ void ExecuteUFOApp (void)
  *----------------------------------------------------------------------------*/
 static void scRefreshLCDCallback(void)
 {
-    ClearLCD();
+    SPRITE_SLOT_T *psSlot;
+#if (UFO_RENDER_MODE == RENDER_SCROLL)
+    WORD wLine;
+#endif
 
-    scDisplayUFO(scwUFOx, scwUFOy);
+    scPlaceUFO(scwUFOx, scwUFOy);
 
     scwGrenade1y += 8;
     scwGrenade2y += 8;
     scwGrenade3y += 8;
-    scDisplayGrenade(scwGrenade1x, scwGrenade1y);
-    scDisplayGrenade(scwGrenade2x, scwGrenade2y);
-    scDisplayGrenade(scwGrenade3x, scwGrenade3y);
+    scPlaceGrenade(1, scwGrenade1x, scwGrenade1y);
+    scPlaceGrenade(2, scwGrenade2x, scwGrenade2y);
+    scPlaceGrenade(3, scwGrenade3x, scwGrenade3y);
+
+#if (UFO_RENDER_MODE == RENDER_TILEMAP)
+    if (scfSceneChanged)
+    {
+        TileMapInit(&gsSpriteTileSet, 0);
+        scfSceneChanged = FALSE;
+    }
+
+    /* Lift all sprites off the map before stamping any, so overlapping
+       sprites keep their cells */
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        if (psSlot->fDrawn)
+        {
+            scStampSlot(psSlot, psSlot->wLastX, psSlot->wLastY, TRUE);
+        }
+    }
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        scStampSlot(psSlot, psSlot->wX, psSlot->wY, FALSE);
+        psSlot->wLastX = psSlot->wX;
+        psSlot->wLastY = psSlot->wY;
+        psSlot->fDrawn = TRUE;
+    }
+
+    (void)wTileMapFlush();
+#elif (UFO_RENDER_MODE == RENDER_FRAMEBUFFER)
+    if (scfSceneChanged)
+    {
+        FrameBufferInit(gsSpriteTileSet.pwPalette, 16);
+        scfSceneChanged = FALSE;
+    }
+
+    /* Compose the whole frame off screen, then replace the display at once */
+    FrameBufferClear(0);
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        scPaintSlot(psSlot);
+    }
+    FrameBufferFlush();
+#elif (UFO_RENDER_MODE == RENDER_DIRTYRECT)
+    if (scfSceneChanged)
+    {
+        FrameBufferInit(gsSpriteTileSet.pwPalette, 16);
+        DirtyRectInvalidateAll();
+        scfSceneChanged = FALSE;
+    }
+
+    /* Each sprite damages the box it left and the box it now covers, in
+       landscape coordinates */
+    FrameBufferClear(0);
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        if (psSlot->fDrawn)
+        {
+            DirtyRectMark((SWORD)psSlot->wLastY, (SWORD)psSlot->wLastX,
+                          psSlot->psSprite->wHeight, psSlot->psSprite->wWidth);
+        }
+        DirtyRectMark((SWORD)psSlot->wY, (SWORD)psSlot->wX,
+                      psSlot->psSprite->wHeight, psSlot->psSprite->wWidth);
+        scPaintSlot(psSlot);
+        psSlot->wLastX = psSlot->wX;
+        psSlot->wLastY = psSlot->wY;
+        psSlot->fDrawn = TRUE;
+    }
+    (void)wDirtyRectFlush(FrameBufferFlushRect);
+#elif (UFO_RENDER_MODE == RENDER_SCROLL)
+    if (scfSceneChanged)
+    {
+        scdwCameraX = 0;
+        for (wLine = 0; wLine < SCROLL_LINES; wLine++)
+        {
+            scDrawTerrain(wLine, 0, Y_MAX);
+        }
+        scfSceneChanged = FALSE;
+    }
+    else
+    {
+        for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+        {
+            scRestoreTerrain(psSlot->wLastX, psSlot->wLastY,
+                             psSlot->psSprite->wWidth, psSlot->psSprite->wHeight);
+        }
+    }
+
+    /* The lines scrolling off the left edge come back on the right; only
+       they get new world columns, the rest of the screen is moved by the
+       controller */
+    for (wLine = 0; wLine < SCROLL_STEP; wLine++)
+    {
+        scDrawTerrain(scdwCameraX + SCROLL_LINES + wLine, 0, Y_MAX);
+    }
+    scdwCameraX += SCROLL_STEP;
+    (void)fSetScroll((WORD)(scdwCameraX % SCROLL_LINES));
+
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        scDrawScrolledSprite(psSlot->wX, psSlot->wY, psSlot->psSprite);
+        psSlot->wLastX = psSlot->wX;
+        psSlot->wLastY = psSlot->wY;
+        psSlot->fDrawn = TRUE;
+    }
+#elif (UFO_RENDER_MODE == RENDER_DISPLAYLIST)
+    /* Bands left blank two frames running are skipped, so only the bands
+       under the sprites and those they just left are streamed */
+    DisplayListBegin(BLACK);
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        (void)fDisplayListSprite(psSlot->wX, psSlot->wY, psSlot->psSprite);
+    }
+    (void)wDisplayListRender();
+#elif (UFO_RENDER_MODE == RENDER_SPRITES)
+    if (scfSceneChanged)
+    {
+        ClearLCD();
+        scfSceneChanged = FALSE;
+    }
+    else
+    {
+        /* Erase all old footprints before drawing any sprite, so an erase
+           never cuts into a sprite that overlaps it */
+        for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+        {
+            scEraseUncovered(psSlot);
+        }
+    }
+
+    for (psSlot = scasSlots; psSlot < &scasSlots[SPRITE_SLOTS]; psSlot++)
+    {
+        scDrawSprite(psSlot->wX, psSlot->wY, psSlot->psSprite, psSlot->pfnDrawCompiled);
+        psSlot->wLastX = psSlot->wX;
+        psSlot->wLastY = psSlot->wY;
+        psSlot->fDrawn = TRUE;
+    }
+#endif
 
     if (scwGrenade1y >= (8*24))
     {
@@ -317,9 +562,9 @@ static BOOL scfRegisterCallback (const pfnEventCallback pfnCallback,
 
 /*----------------------------------------------------------------------------
 
-    @Prototype: static void scDisplayUFO (WORD wXPos, WORD wYPos)
+    @Prototype: static void scPlaceUFO (WORD wXPos, WORD wYPos)
 
-    @Description: Display the UFO at given coordinates
+    @Description: Place the UFO at given coordinates for the next frame
 
     @Parameters:  WORD wXPos
                                     WORD wYPos
@@ -331,61 +576,127 @@ static BOOL scfRegisterCallback (const pfnEventCallback pfnCallback,
         04/08/2017       Ali Haidous        Initial Revision
 
  *----------------------------------------------------------------------------*/
-static void scDisplayUFO (WORD wXPos, WORD wYPos)
+static void scPlaceUFO (WORD wXPos, WORD wYPos)
 {
-    WORD wX;
-    WORD wY;
+    /* The sprite spans 13 cells around wXPos and 5 cells around wYPos */
+    scasSlots[UFO_SLOT].wX = wYPos - (2 * CELL_SIZE);
+    scasSlots[UFO_SLOT].wY = wXPos - (6 * CELL_SIZE);
+}
 
-    for (wX = (wXPos - (6 * 8)); wX < (wXPos + (7 * 8)); wX++)
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scPlaceGrenade (BYTE bySlot, WORD wXPos, WORD wYPos)
+
+    @Description: Place a Grenade at given coordinates for the next frame
+
+    @Parameters:  BYTE bySlot - Sprite slot of the grenade, 1 to 3
+                  WORD wXPos
+                                    WORD wYPos
+
+    @Returns: void
+
+    @Revision History:
+        DATE             NAME               REVISION COMMENT
+        04/08/2017       Ali Haidous        Initial Revision
+
+ *----------------------------------------------------------------------------*/
+static void scPlaceGrenade (BYTE bySlot, WORD wXPos, WORD wYPos)
+{
+    /* 3x3 body with a single-cell stem two cells long */
+    scasSlots[bySlot].wX = wYPos - (1 * CELL_SIZE);
+    scasSlots[bySlot].wY = wXPos - (1 * CELL_SIZE);
+}
+
+
+#if (UFO_RENDER_MODE == RENDER_SPRITES)
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scDrawSprite (WORD wX, WORD wY, const SPRITE_T *psSprite,
+                                          void (*pfnDrawCompiled)(WORD wX, WORD wY))
+
+    @Description: Draw a sprite in display coordinates with its compiled
+                  function when it lies entirely inside the clip rectangle,
+                  otherwise with the clipping blitter. Positions off the top
+                  or left edge read as negative and take the blitter too.
+
+    @Parameters:  WORD wX - Top-left row coordinate of the bounding box
+                  WORD wY - Top-left line coordinate of the bounding box
+                  const SPRITE_T *psSprite - Sprite tables
+                  pfnDrawCompiled - Compiled draw function of the same sprite
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scDrawSprite (WORD wX, WORD wY, const SPRITE_T *psSprite,
+                          void (*pfnDrawCompiled)(WORD wX, WORD wY))
+{
+    /* The compiled code does not clip */
+    if (fInsideClipRect(wX, wY, psSprite->wWidth, psSprite->wHeight))
     {
-        for (wY = (wYPos - (2 * 8)); wY < (wYPos + (3 * 8)); wY++)
+        pfnDrawCompiled(wX, wY);
+    }
+    else
+    {
+        BlitSprite(wX, wY, psSprite);
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scEraseUncovered (const SPRITE_SLOT_T *psSlot)
+
+    @Description: Erase the part of a sprite's last drawn footprint that its
+                  footprint for this frame does not cover. Each opaque window
+                  of the old footprint has the new windows subtracted from it,
+                  and the leftover pieces are filled with the background.
+
+    @Parameters:  const SPRITE_SLOT_T *psSlot - Sprite to erase
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scEraseUncovered (const SPRITE_SLOT_T *psSlot)
+{
+    const SPRITE_T *psSprite = psSlot->psSprite;
+    RECT_T asPieces[MAX_ERASE_RECTS];
+    RECT_T sCover;
+    BYTE byOld;
+    BYTE byNew;
+    BYTE byCount;
+    BYTE byPiece;
+    SDWORD sdwX0;
+    SDWORD sdwY0;
+    SDWORD sdwX1;
+    SDWORD sdwY1;
+
+    if (!psSlot->fDrawn)
+    {
+        return;
+    }
+
+    for (byOld = 0; byOld < psSprite->byRunCount; byOld++)
+    {
+        scRunRect(&asPieces[0], &psSprite->psRuns[byOld], psSlot->wLastX, psSlot->wLastY);
+        byCount = 1;
+        for (byNew = 0; (byNew < psSprite->byRunCount) && (byCount > 0); byNew++)
         {
-            if ((((wX >= (wXPos - (6 * 8))) && (wX < (wXPos - (5 * 8)))) ||
-                 ((wX >= (wXPos - (4 * 8))) && (wX < (wXPos - (3 * 8)))) ||
-                 ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
-                 ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
-                 ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
-                 ((wX >= (wXPos + (4 * 8))) && (wX < (wXPos + (5 * 8)))) ||
-                 ((wX >= (wXPos + (6 * 8))) && (wX < (wXPos + (7 * 8))))) &&
-                 ((wY >= (wYPos + (0 * 8))) && (wY < (wYPos + (1 * 8)))))
-            {
-                SetPoint(wY, wX, RED);
-            }
-            if ((((wX >= (wXPos - (5 * 8))) && (wX < (wXPos - (4 * 8)))) ||
-                 ((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
-                 ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
-                 ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
-                 ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8)))) ||
-                 ((wX >= (wXPos + (5 * 8))) && (wX < (wXPos + (6 * 8))))) &&
-                 ((wY >= (wYPos + (0 * 8))) && (wY < (wYPos + (1 * 8)))))
-            {
-                SetPoint(wY, wX, YELLOW);
-            }
-            if ((((wX >= (wXPos - (4 * 8))) && (wX < (wXPos - (3 * 8)))) ||
-                 ((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
-                 ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
-                 ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
-                 ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
-                 ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
-                 ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
-                 ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8)))) ||
-                 ((wX >= (wXPos + (4 * 8))) && (wX < (wXPos + (5 * 8))))) &&
-                (((wY >= (wYPos + (1 * 8))) && (wY < (wYPos + (2 * 8)))) ||
-                 ((wY >= (wYPos - (1 * 8))) && (wY < (wYPos - (0 * 8))))))
-            {
-                SetPoint(wY, wX, BLUE);
-            }
-            if ((((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
-                 ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
-                 ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
-                 ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
-                 ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
-                 ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
-                 ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8))))) &&
-                (((wY >= (wYPos + (2 * 8))) && (wY < (wYPos + (3 * 8)))) ||
-                 ((wY >= (wYPos - (2 * 8))) && (wY < (wYPos - (1 * 8))))))
+            scRunRect(&sCover, &psSprite->psRuns[byNew], psSlot->wX, psSlot->wY);
+            byCount = scbySubtractRect(asPieces, byCount, &sCover);
+        }
+
+        for (byPiece = 0; byPiece < byCount; byPiece++)
+        {
+            /* Display rows span the landscape height and vice versa */
+            sdwX0 = (asPieces[byPiece].sdwX0 < 0) ? 0 : asPieces[byPiece].sdwX0;
+            sdwY0 = (asPieces[byPiece].sdwY0 < 0) ? 0 : asPieces[byPiece].sdwY0;
+            sdwX1 = (asPieces[byPiece].sdwX1 > Y_MAX) ? Y_MAX : asPieces[byPiece].sdwX1;
+            sdwY1 = (asPieces[byPiece].sdwY1 > X_MAX) ? X_MAX : asPieces[byPiece].sdwY1;
+            if ((sdwX0 < sdwX1) && (sdwY0 < sdwY1))
             {
-                SetPoint(wY, wX, BLUE);
+                FillRect((WORD)sdwX0, (WORD)sdwY0, (WORD)(sdwX1 - sdwX0),
+                         (WORD)(sdwY1 - sdwY0), BLACK);
             }
         }
     }
@@ -394,41 +705,306 @@ static void scDisplayUFO (WORD wXPos, WORD wYPos)
 
 /*----------------------------------------------------------------------------
 
-    @Prototype: static void scDisplayGrenade (WORD wXPos, WORD wYPos)
+    @Prototype: static void scRunRect (RECT_T *psRect, const SPRITE_RUN_T *psRun,
+                                       WORD wX, WORD wY)
 
-    @Description: Display the Grenade at given coordinates
+    @Description: Rectangle covered by one opaque window of a sprite drawn
+                  with its bounding box at wX, wY
 
-    @Parameters:  WORD wXPos
-                                    WORD wYPos
+    @Parameters:  RECT_T *psRect - Resulting rectangle
+                  const SPRITE_RUN_T *psRun - Opaque window of the sprite
+                  WORD wX - Top-left row coordinate of the bounding box
+                  WORD wY - Top-left line coordinate of the bounding box
 
     @Returns: void
 
-    @Revision History:
-        DATE             NAME               REVISION COMMENT
-        04/08/2017       Ali Haidous        Initial Revision
+ *----------------------------------------------------------------------------*/
+static void scRunRect (RECT_T *psRect, const SPRITE_RUN_T *psRun, WORD wX, WORD wY)
+{
+    /* Same signed reading of the position as BlitSprite */
+    psRect->sdwX0 = (SWORD)wX + psRun->byX;
+    psRect->sdwY0 = (SWORD)wY + psRun->byY;
+    psRect->sdwX1 = psRect->sdwX0 + psRun->byWidth;
+    psRect->sdwY1 = psRect->sdwY0 + psRun->byHeight;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static BYTE scbySubtractRect (RECT_T *pasPieces, BYTE byCount,
+                                              const RECT_T *psCover)
+
+    @Description: Remove a rectangle from a set of disjoint pieces. A piece
+                  hit by the rectangle is split into up to four pieces
+                  around it. When splitting would leave no room in
+                  MAX_ERASE_RECTS for the pieces still to come the piece is
+                  kept whole, which only erases more than needed: every old
+                  footprint is erased before any sprite is drawn.
+
+    @Parameters:  RECT_T *pasPieces - Pieces, updated in place
+                  BYTE byCount - Number of pieces
+                  const RECT_T *psCover - Rectangle to remove
+
+    @Returns: BYTE Number of pieces left
 
  *----------------------------------------------------------------------------*/
-static void scDisplayGrenade (WORD wXPos, WORD wYPos)
+static BYTE scbySubtractRect (RECT_T *pasPieces, BYTE byCount, const RECT_T *psCover)
 {
-  WORD wX;
-    WORD wY;
+    RECT_T asOut[MAX_ERASE_RECTS];
+    const RECT_T *psPiece;
+    BYTE byOut = 0;
+    BYTE byPiece;
+    SDWORD sdwY0;
+    SDWORD sdwY1;
+
+    for (byPiece = 0; byPiece < byCount; byPiece++)
+    {
+        psPiece = &pasPieces[byPiece];
+
+        if ((psCover->sdwX0 >= psPiece->sdwX1) || (psCover->sdwX1 <= psPiece->sdwX0) ||
+            (psCover->sdwY0 >= psPiece->sdwY1) || (psCover->sdwY1 <= psPiece->sdwY0) ||
+            (byOut + 4 + (byCount - byPiece - 1) > MAX_ERASE_RECTS))
+        {
+            /* Either untouched or no room to split it while keeping every
+               piece still to come */
+            asOut[byOut++] = *psPiece;
+            continue;
+        }
 
-    for (wX = (wXPos - (1 * 8)); wX < (wXPos + (2 * 8)); wX++)
+        /* Full-width bands above and below the cover */
+        sdwY0 = psPiece->sdwY0;
+        sdwY1 = psPiece->sdwY1;
+        if (psPiece->sdwY0 < psCover->sdwY0)
+        {
+            asOut[byOut] = *psPiece;
+            asOut[byOut++].sdwY1 = psCover->sdwY0;
+            sdwY0 = psCover->sdwY0;
+        }
+        if (psCover->sdwY1 < psPiece->sdwY1)
+        {
+            asOut[byOut] = *psPiece;
+            asOut[byOut++].sdwY0 = psCover->sdwY1;
+            sdwY1 = psCover->sdwY1;
+        }
+
+        /* Left and right of the cover within the remaining band */
+        if (psPiece->sdwX0 < psCover->sdwX0)
+        {
+            asOut[byOut].sdwX0 = psPiece->sdwX0;
+            asOut[byOut].sdwX1 = psCover->sdwX0;
+            asOut[byOut].sdwY0 = sdwY0;
+            asOut[byOut++].sdwY1 = sdwY1;
+        }
+        if (psCover->sdwX1 < psPiece->sdwX1)
+        {
+            asOut[byOut].sdwX0 = psCover->sdwX1;
+            asOut[byOut].sdwX1 = psPiece->sdwX1;
+            asOut[byOut].sdwY0 = sdwY0;
+            asOut[byOut++].sdwY1 = sdwY1;
+        }
+    }
+
+    for (byPiece = 0; byPiece < byOut; byPiece++)
     {
-        for (wY = (wYPos - (1 * 8)); wY < (wYPos + (4 * 8)); wY++)
+        pasPieces[byPiece] = asOut[byPiece];
+    }
+
+    return byOut;
+}
+#endif
+
+
+#if (UFO_RENDER_MODE == RENDER_TILEMAP)
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scStampSlot (const SPRITE_SLOT_T *psSlot, WORD wX,
+                                         WORD wY, BOOL fErase)
+
+    @Description: Stamp a sprite's cell map into the tile map, or lift it off
+
+    @Parameters:  const SPRITE_SLOT_T *psSlot - Sprite to stamp
+                  WORD wX - Top-left row coordinate of the bounding box
+                  WORD wY - Top-left line coordinate of the bounding box
+                  BOOL fErase - Lift the sprite off instead
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scStampSlot (const SPRITE_SLOT_T *psSlot, WORD wX, WORD wY, BOOL fErase)
+{
+    /* Landscape columns run along the display's Y axis; positions are cell aligned */
+    TileMapStamp((SWORD)wY / CELL_SIZE, (SWORD)wX / CELL_SIZE,
+                 psSlot->byCellColumns, psSlot->byCellRows, psSlot->pbyCells, fErase);
+}
+#endif
+
+
+#if (UFO_RENDER_MODE == RENDER_FRAMEBUFFER) || (UFO_RENDER_MODE == RENDER_DIRTYRECT)
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scPaintSlot (const SPRITE_SLOT_T *psSlot)
+
+    @Description: Paint a sprite's cell map into the framebuffer at the
+                  position queued for this frame
+
+    @Parameters:  const SPRITE_SLOT_T *psSlot - Sprite to paint
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scPaintSlot (const SPRITE_SLOT_T *psSlot)
+{
+    BYTE byColumn;
+    BYTE byRow;
+    BYTE byColor;
+
+    for (byRow = 0; byRow < psSlot->byCellRows; byRow++)
+    {
+        for (byColumn = 0; byColumn < psSlot->byCellColumns; byColumn++)
         {
-            if ((((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
-                 ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8))))) &&
-                (((wY >= (wYPos + (2 * 8))) && (wY < (wYPos + (3 * 8)))) ||
-                 ((wY >= (wYPos + (3 * 8))) && (wY < (wYPos + (4 * 8))))))
+            byColor = psSlot->pbyCells[(byRow * psSlot->byCellColumns) + byColumn];
+            if (byColor != 0)
             {
-                continue;
-            }
-            else
-            {
-                SetPoint(wY, wX, MAGENTA);
+                /* Landscape columns run along the display's Y axis */
+                FrameBufferFillRect(((SWORD)psSlot->wY + (byColumn * CELL_SIZE)) / FB_SCALE,
+                                    ((SWORD)psSlot->wX + (byRow * CELL_SIZE)) / FB_SCALE,
+                                    CELL_SIZE / FB_SCALE, CELL_SIZE / FB_SCALE, byColor);
             }
         }
     }
 }
+#endif
+
+
+#if (UFO_RENDER_MODE == RENDER_SCROLL)
+/*----------------------------------------------------------------------------
+
+    @Prototype: static WORD scwTerrainHeight (DWORD dwWorldX)
+
+    @Description: Height of the terrain in a world column, interpolated
+                  between the samples around it
+
+    @Parameters:  DWORD dwWorldX - World column
+
+    @Returns: WORD Height in pixels above the bottom of the screen
+
+ *----------------------------------------------------------------------------*/
+static WORD scwTerrainHeight (DWORD dwWorldX)
+{
+    BYTE bySample = (BYTE)((dwWorldX / TERRAIN_SEGMENT) % TERRAIN_SAMPLES);
+    WORD wFrom = scabyTerrainHeight[bySample];
+    WORD wTo = scabyTerrainHeight[(bySample + 1) % TERRAIN_SAMPLES];
+    WORD wStep = (WORD)(dwWorldX % TERRAIN_SEGMENT);
+
+    return (WORD)(((wFrom * (TERRAIN_SEGMENT - wStep)) + (wTo * wStep)) / TERRAIN_SEGMENT);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scDrawTerrain (DWORD dwWorldX, WORD wX0, WORD wX1)
+
+    @Description: Draw part of a world column, sky above and ground below,
+                  on the GRAM line that holds it
+
+    @Parameters:  DWORD dwWorldX - World column
+                  WORD wX0 - First display row coordinate to draw
+                  WORD wX1 - Display row coordinate past the last to draw
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scDrawTerrain (DWORD dwWorldX, WORD wX0, WORD wX1)
+{
+    WORD wLine = (WORD)(dwWorldX % SCROLL_LINES);
+    WORD wGround = Y_MAX - scwTerrainHeight(dwWorldX);     /* Landscape bottom is display right */
+
+    if (wX0 < wGround)
+    {
+        FillRect(wX0, wLine, ((wX1 < wGround) ? wX1 : wGround) - wX0, 1, SKY_COLOR);
+    }
+    if (wX1 > wGround)
+    {
+        wX0 = (wX0 > wGround) ? wX0 : wGround;
+        FillRect(wX0, wLine, wX1 - wX0, 1, GROUND_COLOR);
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scRestoreTerrain (WORD wX, WORD wY, WORD wWidth,
+                                              WORD wHeight)
+
+    @Description: Redraw the terrain under a rectangle of the screen, e.g.
+                  a sprite's old bounding box, at the current camera
+
+    @Parameters:  WORD wX - Top-left row coordinate, read as signed
+                  WORD wY - Top-left line coordinate, read as signed
+                  WORD wWidth - Width in pixels
+                  WORD wHeight - Height in pixels
+
+    @Returns: void
 
+ *----------------------------------------------------------------------------*/
+static void scRestoreTerrain (WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+{
+    SDWORD sdwX0 = ((SWORD)wX < 0) ? 0 : (SWORD)wX;
+    SDWORD sdwX1 = (SDWORD)(SWORD)wX + wWidth;
+    SDWORD sdwY = ((SWORD)wY < 0) ? 0 : (SWORD)wY;
+    SDWORD sdwY1 = (SDWORD)(SWORD)wY + wHeight;
+
+    if (sdwX1 > Y_MAX)
+    {
+        sdwX1 = Y_MAX;
+    }
+    if (sdwY1 > X_MAX)
+    {
+        sdwY1 = X_MAX;
+    }
+    if (sdwX0 >= sdwX1)
+    {
+        return;
+    }
+
+    for (; sdwY < sdwY1; sdwY++)
+    {
+        scDrawTerrain(scdwCameraX + (DWORD)sdwY, (WORD)sdwX0, (WORD)sdwX1);
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scDrawScrolledSprite (WORD wX, WORD wY,
+                                                  const SPRITE_T *psSprite)
+
+    @Description: Draw a sprite at a screen position while the display is
+                  scrolled. Screen lines from 0 sit on GRAM lines from the
+                  scroll offset and wrap around to GRAM line 0, so the
+                  sprite is drawn twice, each time clipped to one side of
+                  the wrap.
+
+    @Parameters:  WORD wX - Top-left row coordinate of the bounding box
+                  WORD wY - Top-left screen line coordinate of the bounding box
+                  const SPRITE_T *psSprite - Sprite to draw
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scDrawScrolledSprite (WORD wX, WORD wY, const SPRITE_T *psSprite)
+{
+    WORD wShift = (WORD)(scdwCameraX % SCROLL_LINES);
+
+    if (fPushClipRect(0, wShift, Y_MAX, SCROLL_LINES - wShift))
+    {
+        BlitSprite(wX, wY + wShift, psSprite);
+        PopClipRect();
+    }
+    if ((wShift != 0) && fPushClipRect(0, 0, Y_MAX, wShift))
+    {
+        BlitSprite(wX, wY + wShift - SCROLL_LINES, psSprite);
+        PopClipRect();
+    }
+}
+#endif
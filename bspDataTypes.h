@@ -24,13 +24,19 @@
 
 #define TRUE (BYTE)1
 #define FALSE !TRUE
+#ifdef __cplusplus
+#define NULL_PTR 0
+#else
 #define NULL_PTR (void *)0
+#endif
 	
 
 typedef uint8_t BYTE;
 typedef uint16_t WORD;
 typedef uint32_t DWORD;
 typedef uint64_t QWORD;
+typedef int16_t SWORD;
+typedef int32_t SDWORD;
 
 typedef BYTE BOOL;
 	
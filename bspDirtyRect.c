@@ -0,0 +1,269 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* -- COMPILER DIRECTIVES -- */
+
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspDirtyRect.h"
+
+/* -- DEFINES and ENUMS -- */
+#define DIRTY_FULL_COST     (((DWORD)X_MAX * Y_MAX) + DIRTY_WINDOW_COST)
+
+/* -- TYPEDEFS and STRUCTURES -- */
+/* Landscape screen coordinates, X1 and Y1 exclusive, always clipped */
+typedef struct
+{
+    WORD wX0;
+    WORD wY0;
+    WORD wX1;
+    WORD wY1;
+} DIRTY_RECT_T;
+
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+static DIRTY_RECT_T scasRects[DIRTY_MAX_RECTS];
+static BYTE scbyCount;
+static BOOL scfFull;
+static WORD scwMarked;
+static DIRTY_STATS_T scsStats;      /* Last flushed frame */
+
+/* -- STATIC FUNCTION PROTOTYPES -- */
+static DWORD scdwCost(const DIRTY_RECT_T *psRect);
+static BOOL scfMerge(DIRTY_RECT_T *psInto, const DIRTY_RECT_T *psRect);
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DirtyRectMark(SWORD swX, SWORD swY, WORD wWidth, WORD wHeight)
+
+    @Description: Mark a screen area as changed since the last flush. The
+                  area is merged with every pending rectangle for which one
+                  window over both costs no more than two windows, until no
+                  merge is left. When all slots are taken the frame falls
+                  back to a full flush.
+
+    @Parameters: SWORD swX - Left edge, landscape coordinates, may be off screen
+                 SWORD swY - Top edge
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DirtyRectMark(SWORD swX, SWORD swY, WORD wWidth, WORD wHeight)
+{
+    SDWORD sdwX1 = (SDWORD)swX + wWidth;
+    SDWORD sdwY1 = (SDWORD)swY + wHeight;
+    DIRTY_RECT_T sRect;
+    BYTE byRect;
+
+    if (sdwX1 > X_MAX)
+    {
+        sdwX1 = X_MAX;
+    }
+    if (sdwY1 > Y_MAX)
+    {
+        sdwY1 = Y_MAX;
+    }
+    sRect.wX0 = (swX < 0) ? 0 : (WORD)swX;
+    sRect.wY0 = (swY < 0) ? 0 : (WORD)swY;
+    if ((sdwX1 <= (SDWORD)sRect.wX0) || (sdwY1 <= (SDWORD)sRect.wY0))
+    {
+        return;
+    }
+    sRect.wX1 = (WORD)sdwX1;
+    sRect.wY1 = (WORD)sdwY1;
+    scwMarked++;
+
+    if (scfFull)
+    {
+        return;
+    }
+
+    /* A merge grows the rectangle, which may make it worth merging with one
+       already passed, so start over after each */
+    byRect = 0;
+    while (byRect < scbyCount)
+    {
+        if (scfMerge(&sRect, &scasRects[byRect]))
+        {
+            scasRects[byRect] = scasRects[--scbyCount];
+            byRect = 0;
+        }
+        else
+        {
+            byRect++;
+        }
+    }
+
+    if (scbyCount >= DIRTY_MAX_RECTS)
+    {
+        scfFull = TRUE;
+        scbyCount = 0;
+    }
+    else
+    {
+        scasRects[scbyCount++] = sRect;
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DirtyRectInvalidateAll(void)
+
+    @Description: Mark the whole screen as changed, e.g. after a scene change.
+
+    @Parameters: void
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DirtyRectInvalidateAll(void)
+{
+    scfFull = TRUE;
+    scbyCount = 0;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: WORD wDirtyRectFlush(DIRTY_FLUSH_PFN pfnFlush)
+
+    @Description: End the frame: hand every pending rectangle to pfnFlush,
+                  or the whole screen once if that is cheaper or the tracker
+                  overflowed, then start the next frame empty.
+
+    @Parameters: DIRTY_FLUSH_PFN pfnFlush - Writes one screen area to the display
+
+    @Returns: WORD Number of windows flushed
+
+ *----------------------------------------------------------------------------*/
+WORD wDirtyRectFlush(DIRTY_FLUSH_PFN pfnFlush)
+{
+    DWORD dwCost = 0;
+    BYTE byRect;
+
+    for (byRect = 0; byRect < scbyCount; byRect++)
+    {
+        dwCost += scdwCost(&scasRects[byRect]);
+    }
+    if (dwCost >= DIRTY_FULL_COST)
+    {
+        scfFull = TRUE;
+    }
+
+    scsStats.wMarked = scwMarked;
+    scsStats.fFullFlush = scfFull;
+    if (scfFull)
+    {
+        pfnFlush(0, 0, X_MAX, Y_MAX);
+        scsStats.wRects = 1;
+        scsStats.dwPixels = (DWORD)X_MAX * Y_MAX;
+    }
+    else
+    {
+        for (byRect = 0; byRect < scbyCount; byRect++)
+        {
+            pfnFlush(scasRects[byRect].wX0, scasRects[byRect].wY0,
+                     scasRects[byRect].wX1 - scasRects[byRect].wX0,
+                     scasRects[byRect].wY1 - scasRects[byRect].wY0);
+        }
+        scsStats.wRects = scbyCount;
+        scsStats.dwPixels = dwCost - ((DWORD)scbyCount * DIRTY_WINDOW_COST);
+    }
+
+    scbyCount = 0;
+    scfFull = FALSE;
+    scwMarked = 0;
+
+    return scsStats.wRects;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DirtyRectGetStats(DIRTY_STATS_T *psStats)
+
+    @Description: Report what the last wDirtyRectFlush did, for tuning.
+
+    @Parameters: DIRTY_STATS_T *psStats - Filled with the last frame's counts
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DirtyRectGetStats(DIRTY_STATS_T *psStats)
+{
+    *psStats = scsStats;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static DWORD scdwCost(const DIRTY_RECT_T *psRect)
+
+    @Description: Cost of flushing a rectangle in its own window, in pixel
+                  writes.
+
+    @Parameters: const DIRTY_RECT_T *psRect - Rectangle
+
+    @Returns: DWORD Cost
+
+ *----------------------------------------------------------------------------*/
+static DWORD scdwCost(const DIRTY_RECT_T *psRect)
+{
+    return ((DWORD)(psRect->wX1 - psRect->wX0) * (psRect->wY1 - psRect->wY0)) + DIRTY_WINDOW_COST;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static BOOL scfMerge(DIRTY_RECT_T *psInto, const DIRTY_RECT_T *psRect)
+
+    @Description: Grow psInto to the bounding box of both rectangles if one
+                  window over it costs no more than the two windows do.
+                  Overlapping pixels count twice when flushed separately.
+
+    @Parameters: DIRTY_RECT_T *psInto - Rectangle to grow
+                 const DIRTY_RECT_T *psRect - Rectangle to merge in
+
+    @Returns: BOOL TRUE - Merged
+                   FALSE - Kept apart, psInto unchanged
+
+ *----------------------------------------------------------------------------*/
+static BOOL scfMerge(DIRTY_RECT_T *psInto, const DIRTY_RECT_T *psRect)
+{
+    DIRTY_RECT_T sUnion;
+
+    sUnion.wX0 = (psRect->wX0 < psInto->wX0) ? psRect->wX0 : psInto->wX0;
+    sUnion.wY0 = (psRect->wY0 < psInto->wY0) ? psRect->wY0 : psInto->wY0;
+    sUnion.wX1 = (psRect->wX1 > psInto->wX1) ? psRect->wX1 : psInto->wX1;
+    sUnion.wY1 = (psRect->wY1 > psInto->wY1) ? psRect->wY1 : psInto->wY1;
+
+    if (scdwCost(&sUnion) > (scdwCost(psInto) + scdwCost(psRect)))
+    {
+        return FALSE;
+    }
+    *psInto = sUnion;
+
+    return TRUE;
+}
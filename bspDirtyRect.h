@@ -0,0 +1,59 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* -- COMPILER DIRECTIVES -- */
+#ifndef __BSP_DIRTYRECT_H__
+#define __BSP_DIRTYRECT_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHardwareAbstractionLayer.h"
+
+/* -- DEFINES and ENUMS -- */
+#define DIRTY_MAX_RECTS     16  /* Past this the frame falls back to a full flush */
+
+/* Cost of opening a window in pixel writes: the cursor and window
+   registers take about 104 bus stores, a pixel takes 5 */
+#ifndef DIRTY_WINDOW_COST
+#define DIRTY_WINDOW_COST   20
+#endif
+
+/* -- TYPEDEFS and STRUCTURES -- */
+/* Called once per flushed rectangle, landscape screen coordinates */
+typedef void (*DIRTY_FLUSH_PFN)(WORD wX, WORD wY, WORD wWidth, WORD wHeight);
+
+typedef struct
+{
+    WORD wMarked;               /* DirtyRectMark calls that hit the screen */
+    WORD wRects;                /* Windows flushed */
+    DWORD dwPixels;             /* Pixels flushed */
+    BOOL fFullFlush;            /* Frame fell back to one full-screen flush */
+} DIRTY_STATS_T;
+
+
+/* -- GLOBAL VARIABLES -- */
+
+
+/* -- EXTERNAL FUNCTIONS -- */
+extern void DirtyRectMark(SWORD swX, SWORD swY, WORD wWidth, WORD wHeight);
+extern void DirtyRectInvalidateAll(void);
+extern WORD wDirtyRectFlush(DIRTY_FLUSH_PFN pfnFlush);
+extern void DirtyRectGetStats(DIRTY_STATS_T *psStats);
+
+#endif /* __BSP_DIRTYRECT_H__ */
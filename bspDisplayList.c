@@ -0,0 +1,620 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* -- COMPILER DIRECTIVES -- */
+
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspDisplayList.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+
+/* -- DEFINES and ENUMS -- */
+#define DL_WIDTH        Y_MAX   /* Display rows span the landscape height */
+#define DL_HEIGHT       X_MAX
+#define DL_BANDS        ((DL_HEIGHT + DL_BAND_ROWS - 1) / DL_BAND_ROWS)
+#define DL_CHAR_WIDTH   8       /* AsciiLib glyphs */
+#define DL_CHAR_HEIGHT  16
+
+typedef enum
+{
+    DL_RECT,
+    DL_SPRITE,
+    DL_TEXT,
+    DL_LINE
+} DL_TYPE_E;
+
+/* -- TYPEDEFS and STRUCTURES -- */
+typedef struct
+{
+    DL_TYPE_E eType;
+    SWORD swX;
+    SWORD swY;
+    SWORD swX1;                 /* Rect: right edge, exclusive; line: end point */
+    SWORD swY1;
+    SWORD swTop;                /* Rows touched, bottom exclusive */
+    SWORD swBottom;
+    WORD wColor;
+    const void *pvData;         /* Sprite or text */
+    SWORD swWalkX;              /* Line: next point of the walk, kept between bands */
+    SWORD swWalkY;
+    SDWORD sdwWalkError;
+} DL_COMMAND_T;
+
+/* Active commands are tracked in one QWORD bitmask */
+typedef char DL_ActiveMaskCheck[(DL_MAX_COMMANDS <= 64) ? 1 : -1];
+
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+static DL_COMMAND_T scasCommands[DL_MAX_COMMANDS];
+static BYTE scabyOrder[DL_MAX_COMMANDS];        /* Commands sorted by top row */
+static BYTE scbyCount;
+static WORD scwBackground;
+static DWORD scdwBandsDirty = 0xFFFFFFFF;        /* Bands not known to be background */
+static WORD scawBand[DL_BAND_ROWS * DL_WIDTH];
+
+/* -- STATIC FUNCTION PROTOTYPES -- */
+static DL_COMMAND_T *scpsNewCommand(DL_TYPE_E eType, SWORD swTop, SWORD swBottom);
+static void scRasterRect(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows);
+static void scRasterSprite(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows);
+static void scRasterText(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows);
+static void scRasterLine(DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows);
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DisplayListBegin(WORD wBackground)
+
+    @Description: Start recording a new frame. Commands are drawn in the
+                  order they are recorded, later ones on top.
+
+    @Parameters: WORD wBackground - Color of every pixel no command covers
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DisplayListBegin(WORD wBackground)
+{
+    if (wBackground != scwBackground)
+    {
+        scdwBandsDirty = 0xFFFFFFFF;
+    }
+    scwBackground = wBackground;
+    scbyCount = 0;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fDisplayListRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+                                      WORD wColor)
+
+    @Description: Record a filled rectangle.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+                 WORD wColor - Fill color
+
+    @Returns: BOOL TRUE - Recorded
+                   FALSE - The display list is full
+
+ *----------------------------------------------------------------------------*/
+BOOL fDisplayListRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight, WORD wColor)
+{
+    DL_COMMAND_T *psCmd = scpsNewCommand(DL_RECT, (SWORD)wY, (SWORD)((SWORD)wY + wHeight));
+
+    if (psCmd == NULL_PTR)
+    {
+        return FALSE;
+    }
+    psCmd->swX = (SWORD)wX;
+    psCmd->swY = (SWORD)wY;
+    psCmd->swX1 = (SWORD)((SWORD)wX + wWidth);
+    psCmd->wColor = wColor;
+
+    return TRUE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fDisplayListSprite(WORD wX, WORD wY, const SPRITE_T *psSprite)
+
+    @Description: Record a sprite; its transparent pixels leave what is
+                  under them.
+
+    @Parameters: WORD wX - Top-left row coordinate of the bounding box
+                 WORD wY - Top-left line coordinate of the bounding box
+                 const SPRITE_T *psSprite - Sprite, kept until the frame is rendered
+
+    @Returns: BOOL TRUE - Recorded
+                   FALSE - The display list is full
+
+ *----------------------------------------------------------------------------*/
+BOOL fDisplayListSprite(WORD wX, WORD wY, const SPRITE_T *psSprite)
+{
+    DL_COMMAND_T *psCmd = scpsNewCommand(DL_SPRITE, (SWORD)wY,
+                                         (SWORD)((SWORD)wY + psSprite->wHeight));
+
+    if (psCmd == NULL_PTR)
+    {
+        return FALSE;
+    }
+    psCmd->swX = (SWORD)wX;
+    psCmd->swY = (SWORD)wY;
+    psCmd->pvData = psSprite;
+
+    return TRUE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fDisplayListText(WORD wX, WORD wY, const BYTE *pbyText,
+                                      WORD wColor)
+
+    @Description: Record a line of text in the 8x16 ASCII font with a
+                  transparent background.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 const BYTE *pbyText - Zero terminated, kept until the frame is rendered
+                 WORD wColor - Text color
+
+    @Returns: BOOL TRUE - Recorded
+                   FALSE - The display list is full
+
+ *----------------------------------------------------------------------------*/
+BOOL fDisplayListText(WORD wX, WORD wY, const BYTE *pbyText, WORD wColor)
+{
+    DL_COMMAND_T *psCmd = scpsNewCommand(DL_TEXT, (SWORD)wY,
+                                         (SWORD)((SWORD)wY + DL_CHAR_HEIGHT));
+
+    if (psCmd == NULL_PTR)
+    {
+        return FALSE;
+    }
+    psCmd->swX = (SWORD)wX;
+    psCmd->swY = (SWORD)wY;
+    psCmd->wColor = wColor;
+    psCmd->pvData = pbyText;
+
+    return TRUE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fDisplayListLine(WORD wX0, WORD wY0, WORD wX1, WORD wY1,
+                                      WORD wColor)
+
+    @Description: Record a one pixel wide line, both end points included.
+
+    @Parameters: WORD wX0, wY0 - Start point
+                 WORD wX1, wY1 - End point
+                 WORD wColor - Line color
+
+    @Returns: BOOL TRUE - Recorded
+                   FALSE - The display list is full
+
+ *----------------------------------------------------------------------------*/
+BOOL fDisplayListLine(WORD wX0, WORD wY0, WORD wX1, WORD wY1, WORD wColor)
+{
+    DL_COMMAND_T *psCmd;
+
+    /* Keep the start point on top, so the line walks down the bands */
+    if ((SWORD)wY1 < (SWORD)wY0)
+    {
+        psCmd = scpsNewCommand(DL_LINE, (SWORD)wY1, (SWORD)((SWORD)wY0 + 1));
+        if (psCmd != NULL_PTR)
+        {
+            psCmd->swX = (SWORD)wX1;
+            psCmd->swY = (SWORD)wY1;
+            psCmd->swX1 = (SWORD)wX0;
+            psCmd->swY1 = (SWORD)wY0;
+        }
+    }
+    else
+    {
+        psCmd = scpsNewCommand(DL_LINE, (SWORD)wY0, (SWORD)((SWORD)wY1 + 1));
+        if (psCmd != NULL_PTR)
+        {
+            psCmd->swX = (SWORD)wX0;
+            psCmd->swY = (SWORD)wY0;
+            psCmd->swX1 = (SWORD)wX1;
+            psCmd->swY1 = (SWORD)wY1;
+        }
+    }
+
+    if (psCmd == NULL_PTR)
+    {
+        return FALSE;
+    }
+    psCmd->wColor = wColor;
+
+    return TRUE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: WORD wDisplayListRender(void)
+
+    @Description: Rasterize the recorded frame band by band. Each band is
+                  composited in RAM from the commands that touch it, in
+                  recording order, then streamed through one window in one
+                  burst, so no pixel is written to the display twice. A band
+                  that no command touches is skipped if it was background
+                  in the previous frame too.
+
+    @Parameters: void
+
+    @Returns: WORD Number of bands streamed
+
+ *----------------------------------------------------------------------------*/
+WORD wDisplayListRender(void)
+{
+    QWORD qwActive = 0;             /* Commands touching the band, by recording order */
+    DWORD dwBandsUsed = 0;
+    DL_COMMAND_T *psCmd;
+    BYTE byNext = 0;
+    BYTE byCmd;
+    BYTE byKey;
+    BYTE byBand;
+    SWORD swBandY;
+    WORD wRows;
+    WORD wPixel;
+    WORD wStreamed = 0;
+
+    /* Insertion sort by top row; few commands, mostly recorded in order */
+    for (byCmd = 0; byCmd < scbyCount; byCmd++)
+    {
+        byKey = byCmd;
+        for (byNext = byCmd; (byNext > 0) &&
+             (scasCommands[scabyOrder[byNext - 1]].swTop > scasCommands[byKey].swTop); byNext--)
+        {
+            scabyOrder[byNext] = scabyOrder[byNext - 1];
+        }
+        scabyOrder[byNext] = byKey;
+    }
+    byNext = 0;
+
+    for (byBand = 0; byBand < DL_BANDS; byBand++)
+    {
+        swBandY = (SWORD)(byBand * DL_BAND_ROWS);
+        wRows = ((DL_HEIGHT - swBandY) < DL_BAND_ROWS) ? (WORD)(DL_HEIGHT - swBandY) : DL_BAND_ROWS;
+
+        /* Activate commands starting above the band's bottom, retire those
+           ending above its top */
+        while ((byNext < scbyCount) && (scasCommands[scabyOrder[byNext]].swTop < swBandY + (SWORD)wRows))
+        {
+            qwActive |= (QWORD)1 << scabyOrder[byNext++];
+        }
+        for (byCmd = 0; byCmd < scbyCount; byCmd++)
+        {
+            if (((qwActive >> byCmd) & 1) && (scasCommands[byCmd].swBottom <= swBandY))
+            {
+                qwActive &= ~((QWORD)1 << byCmd);
+            }
+        }
+
+        if (qwActive == 0)
+        {
+            if (((scdwBandsDirty >> byBand) & 1) == 0)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            dwBandsUsed |= 1UL << byBand;
+        }
+
+        for (wPixel = 0; wPixel < (wRows * DL_WIDTH); wPixel++)
+        {
+            scawBand[wPixel] = scwBackground;
+        }
+        for (byCmd = 0, psCmd = scasCommands; byCmd < scbyCount; byCmd++, psCmd++)
+        {
+            if (((qwActive >> byCmd) & 1) == 0)
+            {
+                continue;
+            }
+            switch (psCmd->eType)
+            {
+                case DL_RECT:
+                    scRasterRect(psCmd, swBandY, wRows);
+                    break;
+
+                case DL_SPRITE:
+                    scRasterSprite(psCmd, swBandY, wRows);
+                    break;
+
+                case DL_TEXT:
+                    scRasterText(psCmd, swBandY, wRows);
+                    break;
+
+                case DL_LINE:
+                    scRasterLine(psCmd, swBandY, wRows);
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        LCD_BeginWrite(0, (WORD)swBandY, DL_WIDTH, wRows);
+        LCD_WritePixels(scawBand, (DWORD)wRows * DL_WIDTH);
+        LCD_EndWrite();
+        wStreamed++;
+    }
+
+    scdwBandsDirty = dwBandsUsed;
+
+    return wStreamed;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static DL_COMMAND_T *scpsNewCommand(DL_TYPE_E eType, SWORD swTop,
+                                                    SWORD swBottom)
+
+    @Description: Take the next command from the arena.
+
+    @Parameters: DL_TYPE_E eType - Command type
+                 SWORD swTop - First row the command touches
+                 SWORD swBottom - Row below the last one it touches
+
+    @Returns: DL_COMMAND_T * Command to fill in, NULL_PTR if the list is full
+
+ *----------------------------------------------------------------------------*/
+static DL_COMMAND_T *scpsNewCommand(DL_TYPE_E eType, SWORD swTop, SWORD swBottom)
+{
+    DL_COMMAND_T *psCmd;
+
+    if (scbyCount >= DL_MAX_COMMANDS)
+    {
+        return NULL_PTR;
+    }
+    psCmd = &scasCommands[scbyCount++];
+    psCmd->eType = eType;
+    psCmd->swTop = swTop;
+    psCmd->swBottom = swBottom;
+
+    return psCmd;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scRasterRect(const DL_COMMAND_T *psCmd, SWORD swBandY,
+                                         WORD wRows)
+
+    @Description: Fill the part of a rectangle inside the band.
+
+    @Parameters: const DL_COMMAND_T *psCmd - Rectangle command
+                 SWORD swBandY - First display row of the band
+                 WORD wRows - Rows in the band
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scRasterRect(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows)
+{
+    SWORD swX0 = (psCmd->swX < 0) ? 0 : psCmd->swX;
+    SWORD swX1 = (psCmd->swX1 > DL_WIDTH) ? DL_WIDTH : psCmd->swX1;
+    SWORD swY0 = (psCmd->swTop < swBandY) ? swBandY : psCmd->swTop;
+    SWORD swY1 = (psCmd->swBottom > swBandY + (SWORD)wRows) ? swBandY + (SWORD)wRows : psCmd->swBottom;
+    SWORD swX;
+    WORD *pwRow;
+
+    for (; swY0 < swY1; swY0++)
+    {
+        pwRow = &scawBand[(swY0 - swBandY) * DL_WIDTH];
+        for (swX = swX0; swX < swX1; swX++)
+        {
+            pwRow[swX] = psCmd->wColor;
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scRasterSprite(const DL_COMMAND_T *psCmd, SWORD swBandY,
+                                           WORD wRows)
+
+    @Description: Copy the opaque pixels of a sprite inside the band.
+
+    @Parameters: const DL_COMMAND_T *psCmd - Sprite command
+                 SWORD swBandY - First display row of the band
+                 WORD wRows - Rows in the band
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scRasterSprite(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows)
+{
+    const SPRITE_T *psSprite = (const SPRITE_T *)psCmd->pvData;
+    const SPRITE_RUN_T *psRun = psSprite->psRuns;
+    const BYTE *pbyPixels = psSprite->pbyPixels;
+    const BYTE *pbyRow;
+    WORD wStride;
+    BYTE byRun;
+    SWORD swRunX;
+    SWORD swRunY;
+    SWORD swY;
+    SWORD swX;
+    BYTE byColumn;
+    BYTE byIndex;                   /* 0 is transparent */
+
+    for (byRun = 0; byRun < psSprite->byRunCount; byRun++, psRun++)
+    {
+        wStride = (psRun->byWidth + 1) >> 1;
+        swRunX = psCmd->swX + psRun->byX;
+        swRunY = psCmd->swY + psRun->byY;
+
+        for (swY = swRunY; swY < swRunY + psRun->byHeight; swY++)
+        {
+            if ((swY < swBandY) || (swY >= swBandY + (SWORD)wRows))
+            {
+                continue;
+            }
+            pbyRow = pbyPixels + ((swY - swRunY) * wStride);
+            for (byColumn = 0; byColumn < psRun->byWidth; byColumn++)
+            {
+                swX = swRunX + byColumn;
+                byIndex = (pbyRow[byColumn >> 1] >> ((byColumn & 1) ? 0 : 4)) & 0x0F;
+                if ((byIndex != 0) && (swX >= 0) && (swX < DL_WIDTH))
+                {
+                    scawBand[((swY - swBandY) * DL_WIDTH) + swX] = psSprite->pwPalette[byIndex];
+                }
+            }
+        }
+        pbyPixels += wStride * psRun->byHeight;
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scRasterText(const DL_COMMAND_T *psCmd, SWORD swBandY,
+                                         WORD wRows)
+
+    @Description: Draw the glyph rows of a text line inside the band.
+                  Codes without a glyph are left blank.
+
+    @Parameters: const DL_COMMAND_T *psCmd - Text command
+                 SWORD swBandY - First display row of the band
+                 WORD wRows - Rows in the band
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scRasterText(const DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows)
+{
+    const BYTE *pbyText = (const BYTE *)psCmd->pvData;
+    const BYTE *pbyGlyph;
+    SWORD swCharX;
+    SWORD swY;
+    SWORD swX;
+    BYTE byBit;
+
+    for (swCharX = psCmd->swX; (*pbyText != 0) && (swCharX < DL_WIDTH); pbyText++, swCharX += DL_CHAR_WIDTH)
+    {
+        pbyGlyph = GetASCIIGlyph(*pbyText);
+        if ((swCharX + DL_CHAR_WIDTH <= 0) || (pbyGlyph == NULL_PTR))
+        {
+            continue;
+        }
+        for (swY = psCmd->swY; swY < psCmd->swBottom; swY++)
+        {
+            if ((swY < swBandY) || (swY >= swBandY + (SWORD)wRows))
+            {
+                continue;
+            }
+            for (byBit = 0; byBit < DL_CHAR_WIDTH; byBit++)
+            {
+                swX = swCharX + byBit;
+                if (((pbyGlyph[swY - psCmd->swY] >> (7 - byBit)) & 1) && (swX >= 0) && (swX < DL_WIDTH))
+                {
+                    scawBand[((swY - swBandY) * DL_WIDTH) + swX] = psCmd->wColor;
+                }
+            }
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scRasterLine(DL_COMMAND_T *psCmd, SWORD swBandY,
+                                         WORD wRows)
+
+    @Description: Walk a line with Bresenham's algorithm, plotting the
+                  points inside the band and stopping below it. The walk
+                  starts from the top end in the line's first band and
+                  resumes where the previous band stopped in the others,
+                  so each point is stepped over once a frame.
+
+    @Parameters: DL_COMMAND_T *psCmd - Line command, walk state updated
+                 SWORD swBandY - First display row of the band
+                 WORD wRows - Rows in the band
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scRasterLine(DL_COMMAND_T *psCmd, SWORD swBandY, WORD wRows)
+{
+    SDWORD sdwDx = (psCmd->swX1 > psCmd->swX) ? psCmd->swX1 - psCmd->swX : psCmd->swX - psCmd->swX1;
+    SDWORD sdwDy = psCmd->swY1 - psCmd->swY;
+    SDWORD sdwStepX = (psCmd->swX1 > psCmd->swX) ? 1 : -1;
+    SDWORD sdwX;
+    SDWORD sdwY;
+    SDWORD sdwError;
+    SDWORD sdwError2;
+
+    /* The first band a command is active in holds its top row, or is the
+       top band when the line starts above the display */
+    if ((psCmd->swTop >= swBandY) || (swBandY == 0))
+    {
+        psCmd->swWalkX = psCmd->swX;
+        psCmd->swWalkY = psCmd->swY;
+        psCmd->sdwWalkError = sdwDx - sdwDy;
+    }
+    sdwX = psCmd->swWalkX;
+    sdwY = psCmd->swWalkY;
+    sdwError = psCmd->sdwWalkError;
+
+    for (;;)
+    {
+        if (sdwY >= swBandY + (SWORD)wRows)
+        {
+            /* First point of a later band */
+            psCmd->swWalkX = (SWORD)sdwX;
+            psCmd->swWalkY = (SWORD)sdwY;
+            psCmd->sdwWalkError = sdwError;
+            break;
+        }
+        if ((sdwY >= swBandY) && (sdwX >= 0) && (sdwX < DL_WIDTH))
+        {
+            scawBand[((sdwY - swBandY) * DL_WIDTH) + sdwX] = psCmd->wColor;
+        }
+        if ((sdwX == psCmd->swX1) && (sdwY == psCmd->swY1))
+        {
+            break;
+        }
+        sdwError2 = 2 * sdwError;
+        if (sdwError2 > -sdwDy)
+        {
+            sdwError -= sdwDy;
+            sdwX += sdwStepX;
+        }
+        if (sdwError2 < sdwDx)
+        {
+            sdwError += sdwDx;
+            sdwY++;
+        }
+    }
+}
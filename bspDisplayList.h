@@ -0,0 +1,47 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* -- COMPILER DIRECTIVES -- */
+#ifndef __BSP_DISPLAYLIST_H__
+#define __BSP_DISPLAYLIST_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHardwareAbstractionLayer.h"
+
+/* -- DEFINES and ENUMS -- */
+#define DL_MAX_COMMANDS 64      /* Commands recorded per frame */
+#define DL_BAND_ROWS    16      /* Display rows per band: 240x16 pixels, 7680 bytes */
+
+/* -- TYPEDEFS and STRUCTURES -- */
+
+
+/* -- GLOBAL VARIABLES -- */
+
+
+/* -- EXTERNAL FUNCTIONS -- */
+/* All coordinates are display coordinates read as signed, like BlitSprite */
+extern void DisplayListBegin(WORD wBackground);
+extern BOOL fDisplayListRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight, WORD wColor);
+extern BOOL fDisplayListSprite(WORD wX, WORD wY, const SPRITE_T *psSprite);
+extern BOOL fDisplayListText(WORD wX, WORD wY, const BYTE *pbyText, WORD wColor);
+extern BOOL fDisplayListLine(WORD wX0, WORD wY0, WORD wX1, WORD wY1, WORD wColor);
+extern WORD wDisplayListRender(void);
+
+#endif /* __BSP_DISPLAYLIST_H__ */
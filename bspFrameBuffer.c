@@ -0,0 +1,224 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* -- COMPILER DIRECTIVES -- */
+
+
+/* -- INCLUDES -- */
+#include <string.h>
+#include "bspDataTypes.h"
+#include "bspFrameBuffer.h"
+#include "GLCD.h"
+
+/* -- DEFINES and ENUMS -- */
+
+
+/* -- TYPEDEFS and STRUCTURES -- */
+
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+BYTE gabyFrameBuffer[FB_WIDTH][FB_HEIGHT] FB_LOCATION;
+
+static WORD scawPalette[256];
+
+/* -- STATIC FUNCTION PROTOTYPES -- */
+static void scFlushColumns(WORD wX0, WORD wX1, WORD wY, WORD wHeight);
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FrameBufferInit(const WORD *pwPalette, WORD wColors)
+
+    @Description: Load the color table and clear the framebuffer to color 0.
+                  Colors past wColors are black.
+
+    @Parameters: const WORD *pwPalette - RGB565 colors for the first indices
+                 WORD wColors - Number of colors, at most 256
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FrameBufferInit(const WORD *pwPalette, WORD wColors)
+{
+    WORD wColor;
+
+    for (wColor = 0; wColor < 256; wColor++)
+    {
+        scawPalette[wColor] = (wColor < wColors) ? pwPalette[wColor] : BLACK;
+    }
+    FrameBufferClear(0);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FrameBufferClear(BYTE byColor)
+
+    @Description: Fill the whole framebuffer with one color index.
+
+    @Parameters: BYTE byColor - Color index
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FrameBufferClear(BYTE byColor)
+{
+    memset(gabyFrameBuffer, byColor, sizeof(gabyFrameBuffer));
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FrameBufferFillRect(SWORD swX, SWORD swY, WORD wWidth,
+                                         WORD wHeight, BYTE byColor)
+
+    @Description: Fill a rectangle of the framebuffer with one color index.
+                  The rectangle is clipped, so it may hang off any edge.
+
+    @Parameters: SWORD swX - Left edge, landscape framebuffer coordinates
+                 SWORD swY - Top edge
+                 WORD wWidth - Width in framebuffer pixels
+                 WORD wHeight - Height in framebuffer pixels
+                 BYTE byColor - Color index
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FrameBufferFillRect(SWORD swX, SWORD swY, WORD wWidth, WORD wHeight, BYTE byColor)
+{
+    SDWORD sdwX0 = (swX < 0) ? 0 : swX;
+    SDWORD sdwY0 = (swY < 0) ? 0 : swY;
+    SDWORD sdwX1 = (SDWORD)swX + wWidth;
+    SDWORD sdwY1 = (SDWORD)swY + wHeight;
+    SDWORD sdwX;
+
+    if (sdwX1 > FB_WIDTH)
+    {
+        sdwX1 = FB_WIDTH;
+    }
+    if (sdwY1 > FB_HEIGHT)
+    {
+        sdwY1 = FB_HEIGHT;
+    }
+    if ((sdwX0 >= sdwX1) || (sdwY0 >= sdwY1))
+    {
+        return;
+    }
+
+    for (sdwX = sdwX0; sdwX < sdwX1; sdwX++)
+    {
+        memset(&gabyFrameBuffer[sdwX][sdwY0], byColor, (size_t)(sdwY1 - sdwY0));
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FrameBufferFlush(void)
+
+    @Description: Copy the framebuffer to the whole display, through one
+                  full-screen window unless a partial image holds some of
+                  it. The cost is the same 76800 pixel writes every frame.
+
+    @Parameters: void
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FrameBufferFlush(void)
+{
+    FrameBufferFlushRect(0, 0, X_MAX, Y_MAX);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FrameBufferFlushRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+
+    @Description: Copy part of the framebuffer to the display. The area is
+                  widened vertically to whole framebuffer pixels. Screen
+                  columns held by a partial image (LCD_SetPartialImage) are
+                  skipped, so a status strip there is never overwritten.
+                  Fits DIRTY_FLUSH_PFN.
+
+    @Parameters: WORD wX - Left edge, landscape screen coordinates
+                 WORD wY - Top edge
+                 WORD wWidth - Width in screen pixels
+                 WORD wHeight - Height in screen pixels, the area must be on screen
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FrameBufferFlushRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+{
+    WORD wEnd = wX + wWidth;
+    WORD wColumns;
+
+    /* Landscape columns are the display's lines */
+    for (wX = LCD_BaseLines(wX, &wColumns); (wColumns != 0) && (wX < wEnd);
+         wX = LCD_BaseLines(wX + wColumns, &wColumns))
+    {
+        scFlushColumns(wX, ((wX + wColumns) < wEnd) ? (wX + wColumns) : wEnd, wY, wHeight);
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scFlushColumns(WORD wX0, WORD wX1, WORD wY, WORD wHeight)
+
+    @Description: Copy screen columns wX0 to wX1 - 1 through one window.
+                  Each framebuffer column is looked up in the color table
+                  once, then streamed for every screen column it covers
+                  with every color repeated FB_SCALE times.
+
+    @Parameters: WORD wX0 - First screen column
+                 WORD wX1 - Screen column past the last
+                 WORD wY - Top edge
+                 WORD wHeight - Height in screen pixels
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scFlushColumns(WORD wX0, WORD wX1, WORD wY, WORD wHeight)
+{
+    WORD awLine[FB_HEIGHT];
+    WORD wY0 = wY / FB_SCALE;
+    WORD wY1 = (wY + wHeight + FB_SCALE - 1) / FB_SCALE;
+    WORD wFbX = FB_WIDTH;
+    WORD wFbY;
+    WORD wX;
+
+    /* Landscape columns are the display's rows */
+    LCD_BeginWrite(wY0 * FB_SCALE, wX0, (wY1 - wY0) * FB_SCALE, wX1 - wX0);
+    for (wX = wX0; wX < wX1; wX++)
+    {
+        if ((wX / FB_SCALE) != wFbX)
+        {
+            wFbX = wX / FB_SCALE;
+            for (wFbY = wY0; wFbY < wY1; wFbY++)
+            {
+                awLine[wFbY - wY0] = scawPalette[gabyFrameBuffer[wFbX][wFbY]];
+            }
+        }
+        LCD_WriteScaled(awLine, wY1 - wY0, FB_SCALE);
+    }
+    LCD_EndWrite();
+}
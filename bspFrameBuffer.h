@@ -0,0 +1,67 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* -- COMPILER DIRECTIVES -- */
+#ifndef __BSP_FRAMEBUFFER_H__
+#define __BSP_FRAMEBUFFER_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHardwareAbstractionLayer.h"
+
+/* -- DEFINES and ENUMS -- */
+/* Upscale factor from the framebuffer to the landscape screen: 2 gives a
+   160x120 framebuffer of 19200 bytes, 4 gives 80x60 in 4800 bytes */
+#ifndef FB_SCALE
+#define FB_SCALE        2
+#endif
+
+#define FB_WIDTH        (X_MAX / FB_SCALE)
+#define FB_HEIGHT       (Y_MAX / FB_SCALE)
+
+/* Pixel of the framebuffer in landscape coordinates, for plain memory
+   reads and writes; no bounds check */
+#define FB_PIXEL(x, y)  gabyFrameBuffer[(x)][(y)]
+
+/* Placement in the AHB SRAM banks at 0x2007C000, which the CPU does not use
+   otherwise; both 16KB banks are contiguous, so a 2x framebuffer spans them */
+#ifndef FB_LOCATION
+#if defined (__CC_ARM)
+#define FB_LOCATION     __attribute__((at(0x2007C000), zero_init))
+#else
+#define FB_LOCATION
+#endif
+#endif
+
+/* -- TYPEDEFS and STRUCTURES -- */
+
+
+/* -- GLOBAL VARIABLES -- */
+/* Stored one landscape column after the other, the display's scan order */
+extern BYTE gabyFrameBuffer[FB_WIDTH][FB_HEIGHT];
+
+
+/* -- EXTERNAL FUNCTIONS -- */
+extern void FrameBufferInit(const WORD *pwPalette, WORD wColors);
+extern void FrameBufferClear(BYTE byColor);
+extern void FrameBufferFillRect(SWORD swX, SWORD swY, WORD wWidth, WORD wHeight, BYTE byColor);
+extern void FrameBufferFlush(void);
+extern void FrameBufferFlushRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight);
+
+#endif /* __BSP_FRAMEBUFFER_H__ */
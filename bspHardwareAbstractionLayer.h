@@ -34,17 +34,46 @@ typedef enum
 } UFO_EVENT_E;
 
 // LCD color
+#define BLACK 0x0000
 #define BLUE 0x001F
 #define RED 0xF800
 #define MAGENTA 0xF81F
 #define YELLOW 0xFFE0
+#define GREEN 0x07E0
 
 #define Y_MAX 240
 #define X_MAX 320
 
+/* Character cell of DrawText, display coordinates */
+#define TEXT_CELL_WIDTH 8
+#define TEXT_CELL_HEIGHT 16
+
 /* -- TYPEDEFS and STRUCTURES -- */
 typedef void (*pfnEventCallback)(void);
 
+/* One opaque window of a sprite: a rectangle, relative to the sprite's
+   top-left corner, covering rows that share the same opaque span */
+typedef struct
+{
+    BYTE byX;
+    BYTE byY;
+    BYTE byWidth;
+    BYTE byHeight;
+} SPRITE_RUN_T;
+
+/* Sprite with transparent holes, precomputed as a list of opaque windows.
+   The pixels of each window follow each other in pbyPixels, 4 bits per
+   pixel, high nibble first, every window row padded to whole bytes */
+typedef struct
+{
+    WORD wWidth;                 /* Bounding box */
+    WORD wHeight;
+    BYTE byRunCount;
+    const SPRITE_RUN_T *psRuns;
+    const BYTE *pbyPixels;
+    const WORD *pwPalette;       /* 16 entry RGB565 color table */
+} SPRITE_T;
+
 
 /* -- GLOBAL VARIABLES -- */
 extern QWORD gqw10msTicks;
@@ -58,6 +87,19 @@ extern pfnEventCallback pfnRefreshLCDEvent;
 /* -- EXTERNAL FUNCTIONS -- */
 extern BOOL fHALSetup (void);  /* Generic HAL Setup */
 extern void SetPoint(WORD wX, WORD wY, WORD wColor);
+extern void FillRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight, WORD wColor);
+extern void BlitRGB565(WORD wX, WORD wY, WORD wWidth, WORD wHeight, const WORD *pwPixels);
+extern void BlitPal4(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+                     const BYTE *pbyPixels, const WORD *pwPalette);
+extern void BlitSprite(WORD wX, WORD wY, const SPRITE_T *psSprite);
+extern void BlitSpriteScaled(WORD wX, WORD wY, const SPRITE_T *psSprite, BYTE byScale);
+extern void DrawText(WORD wX, WORD wY, const BYTE *pbyText, BYTE byCount,
+                     WORD wColor, WORD wBackground);
+extern BOOL fPushClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight);
+extern void PopClipRect(void);
+extern BOOL fInsideClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight);
+extern BOOL fSetScroll(WORD wLine);
+extern BOOL fSetStatusStrip(BYTE byStrip, WORD wX, WORD wWidth);
 extern void ClearLCD(void);
 extern BOOL fPollJoyStick(void);
 
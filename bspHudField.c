@@ -0,0 +1,214 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* -- COMPILER DIRECTIVES -- */
+
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHudField.h"
+
+/* -- DEFINES and ENUMS -- */
+
+
+/* -- TYPEDEFS and STRUCTURES -- */
+
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+
+
+/* -- STATIC FUNCTION PROTOTYPES -- */
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void HudFieldInit(HUD_FIELD_T *psField, WORD wX, WORD wY,
+                                  BYTE byCells, WORD wColor, WORD wBackground)
+
+    @Description: Set up a field. Nothing is drawn until its first update,
+                  which draws every cell.
+
+    @Parameters: HUD_FIELD_T *psField - Field to set up
+                 WORD wX - Top-left row coordinate of the first cell
+                 WORD wY - Top-left line coordinate of the first cell
+                 BYTE byCells - Width in characters, up to HUD_FIELD_CELLS
+                 WORD wColor - Text color
+                 WORD wBackground - Cell background color
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void HudFieldInit(HUD_FIELD_T *psField, WORD wX, WORD wY, BYTE byCells,
+                  WORD wColor, WORD wBackground)
+{
+    psField->wX = wX;
+    psField->wY = wY;
+    psField->byCells = (byCells > HUD_FIELD_CELLS) ? HUD_FIELD_CELLS : byCells;
+    psField->wColor = wColor;
+    psField->wBackground = wBackground;
+    psField->fShown = FALSE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void HudFieldInvalidate(HUD_FIELD_T *psField)
+
+    @Description: Forget what the field shows, e.g. after the display was
+                  cleared, so that its next update draws every cell.
+
+    @Parameters: HUD_FIELD_T *psField - Field
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void HudFieldInvalidate(HUD_FIELD_T *psField)
+{
+    psField->fShown = FALSE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BYTE byHudFieldSetText(HUD_FIELD_T *psField, const BYTE *pbyText)
+
+    @Description: Show a string in the field. Each character is compared
+                  with the one on the display, and every run of adjacent
+                  changed cells is drawn in one go; unchanged cells are not
+                  touched. Short strings are padded with spaces, long ones
+                  cut to the field width.
+
+    @Parameters: HUD_FIELD_T *psField - Field
+                 const BYTE *pbyText - Zero terminated string
+
+    @Returns: BYTE Number of cells drawn
+
+ *----------------------------------------------------------------------------*/
+BYTE byHudFieldSetText(HUD_FIELD_T *psField, const BYTE *pbyText)
+{
+    BYTE byCell;
+    BYTE byRun = 0;             /* First cell of the pending run */
+    BYTE byDrawn = 0;
+    BOOL fInRun = FALSE;
+    BYTE byChar;
+
+    for (byCell = 0; byCell <= psField->byCells; byCell++)
+    {
+        if (byCell < psField->byCells)
+        {
+            byChar = (*pbyText != 0) ? *pbyText++ : ' ';
+            if (!psField->fShown || (psField->abyShown[byCell] != byChar))
+            {
+                psField->abyShown[byCell] = byChar;
+                if (!fInRun)
+                {
+                    byRun = byCell;
+                    fInRun = TRUE;
+                }
+                continue;
+            }
+        }
+
+        /* An unchanged cell, or the end of the field, closes the run */
+        if (fInRun)
+        {
+            DrawText(psField->wX + ((WORD)byRun * TEXT_CELL_WIDTH), psField->wY,
+                     &psField->abyShown[byRun], byCell - byRun,
+                     psField->wColor, psField->wBackground);
+            byDrawn += byCell - byRun;
+            fInRun = FALSE;
+        }
+    }
+    psField->fShown = TRUE;
+
+    return byDrawn;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BYTE byHudFieldSetNumber(HUD_FIELD_T *psField, DWORD dwValue,
+                                         BYTE byPad)
+
+    @Description: Show a number right aligned over the whole field width,
+                  see HudFormatNumber
+
+    @Parameters: HUD_FIELD_T *psField - Field
+                 DWORD dwValue - Number to show
+                 BYTE byPad - Fill character of the leading cells, '0' or ' '
+
+    @Returns: BYTE Number of cells drawn
+
+ *----------------------------------------------------------------------------*/
+BYTE byHudFieldSetNumber(HUD_FIELD_T *psField, DWORD dwValue, BYTE byPad)
+{
+    BYTE abyText[HUD_FIELD_CELLS + 1];
+
+    HudFormatNumber(abyText, dwValue, psField->byCells, byPad);
+
+    return byHudFieldSetText(psField, abyText);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void HudFormatNumber(BYTE *pbyText, DWORD dwValue, BYTE byDigits,
+                                     BYTE byPad)
+
+    @Description: Format an unsigned number in a fixed number of characters,
+                  right aligned, without the C library. A value too large
+                  for the width shows as all nines.
+
+    @Parameters: BYTE *pbyText - byDigits characters and a terminating zero
+                 DWORD dwValue - Number to format
+                 BYTE byDigits - Width in characters
+                 BYTE byPad - Fill character of the leading cells, '0' or ' '
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void HudFormatNumber(BYTE *pbyText, DWORD dwValue, BYTE byDigits, BYTE byPad)
+{
+    BYTE byCell = byDigits;
+
+    pbyText[byDigits] = 0;
+    while (byCell > 0)
+    {
+        pbyText[--byCell] = (BYTE)('0' + (dwValue % 10));
+        dwValue /= 10;
+        if (dwValue == 0)
+        {
+            break;
+        }
+    }
+
+    if (dwValue != 0)
+    {
+        for (byCell = 0; byCell < byDigits; byCell++)
+        {
+            pbyText[byCell] = '9';
+        }
+        return;
+    }
+    while (byCell > 0)
+    {
+        pbyText[--byCell] = byPad;
+    }
+}
@@ -0,0 +1,58 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* -- COMPILER DIRECTIVES -- */
+#ifndef __BSP_HUDFIELD_H__
+#define __BSP_HUDFIELD_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHardwareAbstractionLayer.h"
+
+/* -- DEFINES and ENUMS -- */
+#define HUD_FIELD_CELLS     12  /* Longest field, in characters */
+
+/* -- TYPEDEFS and STRUCTURES -- */
+/* A fixed-width text field, e.g. a score or a counter, that remembers what
+   it shows so that an update only redraws the characters that changed.
+   Drawn in DrawText cells. The UFO app does not use it yet. */
+typedef struct
+{
+    WORD wX;                    /* First cell, display coordinates */
+    WORD wY;
+    BYTE byCells;               /* Width in characters */
+    WORD wColor;
+    WORD wBackground;
+    BYTE abyShown[HUD_FIELD_CELLS];     /* Characters on the display */
+    BOOL fShown;                /* abyShown is valid */
+} HUD_FIELD_T;
+
+
+/* -- GLOBAL VARIABLES -- */
+
+
+/* -- EXTERNAL FUNCTIONS -- */
+extern void HudFieldInit(HUD_FIELD_T *psField, WORD wX, WORD wY, BYTE byCells,
+                         WORD wColor, WORD wBackground);
+extern void HudFieldInvalidate(HUD_FIELD_T *psField);
+extern BYTE byHudFieldSetText(HUD_FIELD_T *psField, const BYTE *pbyText);
+extern BYTE byHudFieldSetNumber(HUD_FIELD_T *psField, DWORD dwValue, BYTE byPad);
+extern void HudFormatNumber(BYTE *pbyText, DWORD dwValue, BYTE byDigits, BYTE byPad);
+
+#endif /* __BSP_HUDFIELD_H__ */
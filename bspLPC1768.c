@@ -46,11 +46,21 @@
  #define JS_RIGHT       (1UL<<3)
  #define JS_UP          (1UL<<4)
 
+/* SysTick period, also the time base of the non-blocking display init.
+   Kept at 1 ms so that padding each init delay by a tick costs little */
+#define SYSTICK_PERIOD_MS   1
+#define TICKS_PER_10MS      (10 / SYSTICK_PERIOD_MS)
+#if (SYSTICK_PERIOD_MS > LCD_INIT_TICK_MS)
+#error "LCD_INIT_TICK_MS in GLCD.h must cover the SysTick period"
+#endif
+
 /* -- TYPEDEFS and STRUCTURES -- */
 
 
 /* -- STATIC AND GLOBAL VARIABLES -- */
 QWORD gqw10msTicks;
+static volatile DWORD scdwMsTicks;   /* Free-running ms clock, never reset */
+static BYTE scbyTicksTo10ms = TICKS_PER_10MS;
 
 pfnEventCallback pfnGrenadeEvent;
 pfnEventCallback pfnUFORightCommandEvent;
@@ -95,11 +105,16 @@ void TIMER0_IRQHandler(void)
 
 
 /*----------------------------------------------------------------------------
-  SysTick IRQ: Executed periodically every 10ms
+  SysTick IRQ: Executed periodically every 1ms
  *----------------------------------------------------------------------------*/
-void SysTick_Handler (void) // SysTick Interrupt Handler (10ms);
+void SysTick_Handler (void) // SysTick Interrupt Handler (1ms);
 {
-    gqw10msTicks++;
+    scdwMsTicks += SYSTICK_PERIOD_MS;
+    if (--scbyTicksTo10ms == 0)
+    {
+        scbyTicksTo10ms = TICKS_PER_10MS;
+        gqw10msTicks++;
+    }
 }
 /* End LPC1768 specific interrupt routines */
 
@@ -127,7 +142,12 @@ BOOL fHALSetup (void)
 
     // Initialize LPC1768 system
     SystemInit();
-    scDisplaySetup();
+
+    /* Generate interrupt each ms; started first as it times the display init */
+    SysTick_Config(SystemCoreClock/(1000/SYSTICK_PERIOD_MS));
+
+    /* Start the display init; its power-up delays run during the setup below */
+    LCD_StartInitialization(scdwMsTicks);
 
     // Timer 0 configuration
     LPC_SC->PCONP |= 1 << 1; // Power up Timer 0
@@ -160,8 +180,8 @@ BOOL fHALSetup (void)
     /* Enable the ENT1 and EINT0 interrupts */
     NVIC_EnableIRQ(EINT0_IRQn);
 
-    /* Generate interrupt each 10 ms */
-    SysTick_Config(SystemCoreClock/100);
+    /* Finish the display init and show the first frame */
+    scDisplaySetup();
 
     gqw10msTicks = 0;
 
@@ -248,7 +268,8 @@ BOOL fPollJoyStick(void)
 
     @Prototype: static void scDisplaySetup (void)
 
-    @Description: Display setup routine
+    @Description: Display setup routine, waits for the display init started
+                  by fHALSetup to finish
 
     @Parameters: void
 
@@ -261,7 +282,9 @@ BOOL fPollJoyStick(void)
  *----------------------------------------------------------------------------*/
 static void scDisplaySetup (void)
 {
-    LCD_Initialization(); // Initialize graphical LCD
+    while (!LCD_PollInitialization(scdwMsTicks)) // Initialize graphical LCD
+    {
+    }
     LCD_Clear(Black);  // Clear graphical LCD display
 }
 
@@ -287,6 +310,277 @@ void SetPoint(WORD wX, WORD wY, WORD wColor)
 }
 
 
+/*----------------------------------------------------------------------------
+
+    @Prototype: void FillRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+                              WORD wColor)
+
+    @Description: Fill a rectangle on the display with a single color
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+                 WORD wColor - Fill color
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void FillRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight, WORD wColor)
+{
+    LCD_FillRect(wX, wY, wWidth, wHeight, wColor);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void BlitRGB565(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+                                const WORD *pwPixels)
+
+    @Description: Copy a pre-rendered RGB565 bitmap to the display. The
+                  coordinates are signed, so the bitmap may hang off any edge.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+                 const WORD *pwPixels - wWidth * wHeight colors, row by row
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void BlitRGB565(WORD wX, WORD wY, WORD wWidth, WORD wHeight, const WORD *pwPixels)
+{
+    LCD_BlitRGB565((int16_t)wX, (int16_t)wY, wWidth, wHeight, pwPixels);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void BlitPal4(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+                              const BYTE *pbyPixels, const WORD *pwPalette)
+
+    @Description: Copy a 4 bit per pixel palettized bitmap to the display.
+                  The coordinates are signed, so the bitmap may hang off any
+                  edge.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+                 const BYTE *pbyPixels - Two pixels per byte, high nibble
+                                         first, rows padded to whole bytes
+                 const WORD *pwPalette - 16 entry RGB565 color table
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void BlitPal4(WORD wX, WORD wY, WORD wWidth, WORD wHeight,
+              const BYTE *pbyPixels, const WORD *pwPalette)
+{
+    LCD_BlitPal4((int16_t)wX, (int16_t)wY, wWidth, wHeight, pbyPixels, pwPalette);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void BlitSprite(WORD wX, WORD wY, const SPRITE_T *psSprite)
+
+    @Description: Draw a sprite with transparent holes. Each opaque window
+                  gets its own GRAM window and burst, so transparent pixels
+                  cost no bus cycles. The coordinates are signed, so the
+                  sprite may hang off any edge.
+
+    @Parameters: WORD wX - Top-left row coordinate of the bounding box
+                 WORD wY - Top-left line coordinate of the bounding box
+                 const SPRITE_T *psSprite - Sprite to draw
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void BlitSprite(WORD wX, WORD wY, const SPRITE_T *psSprite)
+{
+    const SPRITE_RUN_T *psRun = psSprite->psRuns;
+    const BYTE *pbyPixels = psSprite->pbyPixels;
+    BYTE byRun;
+
+    for (byRun = 0; byRun < psSprite->byRunCount; byRun++, psRun++)
+    {
+        LCD_BlitPal4((int16_t)(wX + psRun->byX), (int16_t)(wY + psRun->byY),
+                     psRun->byWidth, psRun->byHeight, pbyPixels, psSprite->pwPalette);
+        pbyPixels += ((psRun->byWidth + 1) >> 1) * psRun->byHeight;
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void BlitSpriteScaled(WORD wX, WORD wY, const SPRITE_T *psSprite,
+                                      BYTE byScale)
+
+    @Description: Draw a sprite like BlitSprite, enlarged by an integer
+                  factor. The enlarging happens in the bus stream, window
+                  by window, so the sprite data is used as it is.
+
+    @Parameters: WORD wX - Top-left row coordinate of the bounding box
+                 WORD wY - Top-left line coordinate of the bounding box
+                 const SPRITE_T *psSprite - Sprite to draw
+                 BYTE byScale - Enlarging factor, 1 or more
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void BlitSpriteScaled(WORD wX, WORD wY, const SPRITE_T *psSprite, BYTE byScale)
+{
+    const SPRITE_RUN_T *psRun = psSprite->psRuns;
+    const BYTE *pbyPixels = psSprite->pbyPixels;
+    BYTE byRun;
+
+    for (byRun = 0; byRun < psSprite->byRunCount; byRun++, psRun++)
+    {
+        LCD_BlitPal4Scaled((int16_t)(wX + (psRun->byX * byScale)),
+                           (int16_t)(wY + (psRun->byY * byScale)),
+                           psRun->byWidth, psRun->byHeight, pbyPixels,
+                           psSprite->pwPalette, byScale);
+        pbyPixels += ((psRun->byWidth + 1) >> 1) * psRun->byHeight;
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DrawText(WORD wX, WORD wY, const BYTE *pbyText, BYTE byCount,
+                              WORD wColor, WORD wBackground)
+
+    @Description: Draw characters in TEXT_CELL_WIDTH x TEXT_CELL_HEIGHT
+                  cells side by side, as one window burst, clipped and
+                  without wrapping. The cells are always opaque and in the
+                  AsciiLib font, whatever font and text mode GLCD has set.
+
+    @Parameters: WORD wX - Top-left row coordinate of the first cell
+                 WORD wY - Top-left line coordinate of the first cell
+                 const BYTE *pbyText - Characters, need not be zero terminated
+                 BYTE byCount - Number of characters
+                 WORD wColor - Text color
+                 WORD wBackground - Cell background color
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DrawText(WORD wX, WORD wY, const BYTE *pbyText, BYTE byCount,
+              WORD wColor, WORD wBackground)
+{
+    LCD_PutChars(wX, wY, pbyText, byCount, wColor, wBackground);
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fPushClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+
+    @Description: Restrict all drawing to a rectangle, within the current
+                  clip, until the matching PopClipRect. The coordinates are
+                  signed, like the blits.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+
+    @Returns: BOOL TRUE - Clip pushed
+                   FALSE - Clip stack full, nothing changed
+
+ *----------------------------------------------------------------------------*/
+BOOL fPushClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+{
+    return (LCD_PushClip((int16_t)wX, (int16_t)wY, wWidth, wHeight) != 0) ? TRUE : FALSE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void PopClipRect(void)
+
+    @Description: Restore the clip in effect before the last fPushClipRect.
+
+    @Parameters: void
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void PopClipRect(void)
+{
+    LCD_PopClip();
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fInsideClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+
+    @Description: Check that a rectangle needs no clipping, e.g. before
+                  drawing a compiled sprite, which does not clip.
+
+    @Parameters: WORD wX - Top-left row coordinate
+                 WORD wY - Top-left line coordinate
+                 WORD wWidth - Width in pixels
+                 WORD wHeight - Height in pixels
+
+    @Returns: BOOL TRUE - Entirely inside the clip
+                   FALSE - Partly or wholly clipped
+
+ *----------------------------------------------------------------------------*/
+BOOL fInsideClipRect(WORD wX, WORD wY, WORD wWidth, WORD wHeight)
+{
+    return (LCD_ClipContains((int16_t)wX, (int16_t)wY, wWidth, wHeight) != 0) ? TRUE : FALSE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fSetScroll(WORD wLine)
+
+    @Description: Scroll the whole display in hardware along its line axis.
+                  Line 0 of the display then shows GRAM line wLine, and the
+                  lines wrap around; drawing still addresses GRAM lines.
+
+    @Parameters: WORD wLine - GRAM line shown on the first display line
+
+    @Returns: BOOL TRUE - Scrolled
+                   FALSE - The controller cannot scroll
+
+ *----------------------------------------------------------------------------*/
+BOOL fSetScroll(WORD wLine)
+{
+    return (LCD_SetScroll(wLine) != 0) ? TRUE : FALSE;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BOOL fSetStatusStrip(BYTE byStrip, WORD wX, WORD wWidth)
+
+    @Description: Hold a strip of screen columns for a status display. The
+                  strip is shown in place as a partial image, so it stays
+                  fixed while the display scrolls, and ClearLCD and the
+                  framebuffer flushes leave it alone. Only what is drawn
+                  into it changes it.
+
+    @Parameters: BYTE byStrip - Strip number, 0 or 1
+                 WORD wX - Left edge of the strip
+                 WORD wWidth - Width in pixels, 0 to release the strip
+
+    @Returns: BOOL TRUE - The controller shows the strip as a partial image
+                   FALSE - Not supported; the columns are still held
+
+ *----------------------------------------------------------------------------*/
+BOOL fSetStatusStrip(BYTE byStrip, WORD wX, WORD wWidth)
+{
+    /* Landscape columns are the display's lines */
+    return (LCD_SetPartialImage(byStrip, wX, wX, wWidth) != 0) ? TRUE : FALSE;
+}
+
+
 /*----------------------------------------------------------------------------
 
     @Prototype: void ClearLCD(void)
@@ -0,0 +1,241 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* -- COMPILER DIRECTIVES -- */
+
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspTileMap.h"
+#include "GLCD.h"
+
+/* -- DEFINES and ENUMS -- */
+#define TILE_CELLS          (TILE_COLUMNS * TILE_ROWS)
+#define TILE_DIRTY_WORDS    ((TILE_CELLS + 31) / 32)
+#define TILE_UNKNOWN        0xFF    /* Shown tile of a cell never drawn */
+
+/* -- TYPEDEFS and STRUCTURES -- */
+
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+static const TILE_SET_T *scpsTileSet;
+static BYTE scabyTiles[TILE_CELLS];         /* Tile wanted per cell, row by row */
+static BYTE scabyShown[TILE_CELLS];         /* Tile on the display per cell */
+static DWORD scadwDirty[TILE_DIRTY_WORDS];  /* One bit per cell written since the last flush */
+
+/* -- STATIC FUNCTION PROTOTYPES -- */
+static void scWriteCell(WORD wCell, BYTE byTile);
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void TileMapInit(const TILE_SET_T *psTileSet, BYTE byTile)
+
+    @Description: Select the tile set and fill the whole map with one tile.
+                  The display content is unknown at this point, so the next
+                  flush draws every cell.
+
+    @Parameters: const TILE_SET_T *psTileSet - Tile set in flash
+                 BYTE byTile - Tile for every cell
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void TileMapInit(const TILE_SET_T *psTileSet, BYTE byTile)
+{
+    WORD wCell;
+
+    scpsTileSet = psTileSet;
+    for (wCell = 0; wCell < TILE_CELLS; wCell++)
+    {
+        scabyTiles[wCell] = byTile;
+        scabyShown[wCell] = TILE_UNKNOWN;
+    }
+    for (wCell = 0; wCell < TILE_DIRTY_WORDS; wCell++)
+    {
+        scadwDirty[wCell] = 0xFFFFFFFF;
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void TileMapSet(WORD wColumn, WORD wRow, BYTE byTile)
+
+    @Description: Put a tile into a cell; cells off the grid are ignored.
+
+    @Parameters: WORD wColumn - Landscape cell column, 0 to TILE_COLUMNS - 1
+                 WORD wRow - Landscape cell row, 0 to TILE_ROWS - 1
+                 BYTE byTile - Tile index
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void TileMapSet(WORD wColumn, WORD wRow, BYTE byTile)
+{
+    if ((wColumn < TILE_COLUMNS) && (wRow < TILE_ROWS))
+    {
+        scWriteCell((wRow * TILE_COLUMNS) + wColumn, byTile);
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: BYTE byTileMapGet(WORD wColumn, WORD wRow)
+
+    @Description: Read the tile of a cell.
+
+    @Parameters: WORD wColumn - Landscape cell column, 0 to TILE_COLUMNS - 1
+                 WORD wRow - Landscape cell row, 0 to TILE_ROWS - 1
+
+    @Returns: BYTE Tile index, 0 for cells off the grid
+
+ *----------------------------------------------------------------------------*/
+BYTE byTileMapGet(WORD wColumn, WORD wRow)
+{
+    if ((wColumn < TILE_COLUMNS) && (wRow < TILE_ROWS))
+    {
+        return scabyTiles[(wRow * TILE_COLUMNS) + wColumn];
+    }
+
+    return 0;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void TileMapStamp(SWORD swColumn, SWORD swRow, BYTE byColumns,
+                                  BYTE byRows, const BYTE *pbyCells, BOOL fErase)
+
+    @Description: Copy a block of cells, such as a sprite's cell map, into the
+                  map. Zero cells are transparent and leave the map alone.
+                  When erasing, tile 0 is written wherever the block has a
+                  non-zero cell, which removes a block stamped earlier. The
+                  block may hang off any edge of the grid.
+
+    @Parameters: SWORD swColumn - Landscape column of the block's left edge
+                 SWORD swRow - Landscape row of the block's top edge
+                 BYTE byColumns - Block width in cells
+                 BYTE byRows - Block height in cells
+                 const BYTE *pbyCells - Tile indices, row by row
+                 BOOL fErase - Write tile 0 instead of the block's tiles
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void TileMapStamp(SWORD swColumn, SWORD swRow, BYTE byColumns, BYTE byRows,
+                  const BYTE *pbyCells, BOOL fErase)
+{
+    SDWORD sdwColumn;
+    SDWORD sdwRow;
+    BYTE byColumn;
+    BYTE byRow;
+
+    for (byRow = 0; byRow < byRows; byRow++)
+    {
+        sdwRow = swRow + byRow;
+        if ((sdwRow < 0) || (sdwRow >= TILE_ROWS))
+        {
+            continue;
+        }
+        for (byColumn = 0; byColumn < byColumns; byColumn++)
+        {
+            sdwColumn = swColumn + byColumn;
+            if ((pbyCells[(byRow * byColumns) + byColumn] != 0) &&
+                (sdwColumn >= 0) && (sdwColumn < TILE_COLUMNS))
+            {
+                scWriteCell((WORD)((sdwRow * TILE_COLUMNS) + sdwColumn),
+                            fErase ? 0 : pbyCells[(byRow * byColumns) + byColumn]);
+            }
+        }
+    }
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: WORD wTileMapFlush(void)
+
+    @Description: Draw every cell written since the last flush whose tile
+                  differs from the one on the display, each as an 8x8 window
+                  burst. Cells written back to the tile already shown cost
+                  only the check.
+
+    @Parameters: void
+
+    @Returns: WORD Number of cells drawn
+
+ *----------------------------------------------------------------------------*/
+WORD wTileMapFlush(void)
+{
+    WORD wWord;
+    WORD wCell;
+    WORD wFlushed = 0;
+    DWORD dwBits;
+
+    for (wWord = 0; wWord < TILE_DIRTY_WORDS; wWord++)
+    {
+        dwBits = scadwDirty[wWord];
+        scadwDirty[wWord] = 0;
+
+        for (wCell = wWord * 32; dwBits != 0; wCell++, dwBits >>= 1)
+        {
+            if (((dwBits & 1) == 0) || (wCell >= TILE_CELLS) ||
+                (scabyShown[wCell] == scabyTiles[wCell]))
+            {
+                continue;
+            }
+
+            /* Landscape rows run along the display's X axis */
+            LCD_BlitPal4((int16_t)((wCell / TILE_COLUMNS) * TILE_SIZE),
+                         (int16_t)((wCell % TILE_COLUMNS) * TILE_SIZE),
+                         TILE_SIZE, TILE_SIZE,
+                         &scpsTileSet->pbyTiles[scabyTiles[wCell] * TILE_BYTES],
+                         scpsTileSet->pwPalette);
+            scabyShown[wCell] = scabyTiles[wCell];
+            wFlushed++;
+        }
+    }
+
+    return wFlushed;
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: static void scWriteCell(WORD wCell, BYTE byTile)
+
+    @Description: Store a tile and mark the cell dirty if it changed.
+
+    @Parameters: WORD wCell - Cell index, row by row
+                 BYTE byTile - Tile index
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+static void scWriteCell(WORD wCell, BYTE byTile)
+{
+    if (scabyTiles[wCell] != byTile)
+    {
+        scabyTiles[wCell] = byTile;
+        scadwDirty[wCell / 32] |= 1UL << (wCell % 32);
+    }
+}
@@ -0,0 +1,56 @@
+/* Copyright 2017 Ali Haidous
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* -- COMPILER DIRECTIVES -- */
+#ifndef __BSP_TILEMAP_H__
+#define __BSP_TILEMAP_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+#include "bspHardwareAbstractionLayer.h"
+
+/* -- DEFINES and ENUMS -- */
+/* The landscape screen as a grid of 8x8 cells */
+#define TILE_SIZE       8
+#define TILE_COLUMNS    (X_MAX / TILE_SIZE)
+#define TILE_ROWS       (Y_MAX / TILE_SIZE)
+#define TILE_BYTES      ((TILE_SIZE * TILE_SIZE) / 2)   /* 4 bits per pixel */
+
+/* -- TYPEDEFS and STRUCTURES -- */
+/* Tile set in flash: TILE_BYTES per tile, 4 bits per pixel, high nibble
+   first, in display scan order like the sprites. At most 255 tiles */
+typedef struct
+{
+    const BYTE *pbyTiles;
+    const WORD *pwPalette;      /* 16 entry RGB565 color table */
+} TILE_SET_T;
+
+
+/* -- GLOBAL VARIABLES -- */
+
+
+/* -- EXTERNAL FUNCTIONS -- */
+extern void TileMapInit(const TILE_SET_T *psTileSet, BYTE byTile);
+extern void TileMapSet(WORD wColumn, WORD wRow, BYTE byTile);
+extern BYTE byTileMapGet(WORD wColumn, WORD wRow);
+extern void TileMapStamp(SWORD swColumn, SWORD swRow, BYTE byColumns, BYTE byRows,
+                         const BYTE *pbyCells, BOOL fErase);
+extern WORD wTileMapFlush(void);
+
+#endif /* __BSP_TILEMAP_H__ */
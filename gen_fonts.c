@@ -0,0 +1,895 @@
+/* Generated by tools/fontc.py from fonts.txt - do not edit */
+
+/* -- INCLUDES -- */
+#include "gen_fonts.h"
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+/* Layout in tools/fontc.py; read by LCD_SetFont */
+const BYTE gabyFontBlob[FONT_BLOB_SIZE] =
+{
+    /* directory */
+    0x03, 0x07, 0x00, 0x2D, 0x04, 0x34, 0x09,
+
+    /* Small: 8 high, 1062 bytes */
+    0x08, 0x20, 0x7E, 0x03, 0xC4, 0x00, 0xC6, 0x00, 0xCA, 0x00, 0xCE, 0x00,
+    0xD8, 0x00, 0xE5, 0x00, 0xF0, 0x00, 0xFD, 0x00, 0x02, 0x01, 0x09, 0x01,
+    0x10, 0x01, 0x1B, 0x01, 0x22, 0x01, 0x27, 0x01, 0x2E, 0x01, 0x32, 0x01,
+    0x39, 0x01, 0x46, 0x01, 0x4C, 0x01, 0x5B, 0x01, 0x69, 0x01, 0x72, 0x01,
+    0x81, 0x01, 0x8F, 0x01, 0x9A, 0x01, 0xA9, 0x01, 0xB7, 0x01, 0xBB, 0x01,
+    0xC0, 0x01, 0xC9, 0x01, 0xD5, 0x01, 0xDE, 0x01, 0xE8, 0x01, 0xF5, 0x01,
+    0xFF, 0x01, 0x0D, 0x02, 0x18, 0x02, 0x22, 0x02, 0x30, 0x02, 0x3A, 0x02,
+    0x46, 0x02, 0x4D, 0x02, 0x54, 0x02, 0x5C, 0x02, 0x66, 0x02, 0x6D, 0x02,
+    0x74, 0x02, 0x7B, 0x02, 0x85, 0x02, 0x8F, 0x02, 0x9B, 0x02, 0xA7, 0x02,
+    0xB6, 0x02, 0xBD, 0x02, 0xC4, 0x02, 0xCB, 0x02, 0xD2, 0x02, 0xDD, 0x02,
+    0xE4, 0x02, 0xF3, 0x02, 0xFC, 0x02, 0x03, 0x03, 0x0C, 0x03, 0x13, 0x03,
+    0x1A, 0x03, 0x1F, 0x03, 0x2A, 0x03, 0x34, 0x03, 0x3F, 0x03, 0x49, 0x03,
+    0x56, 0x03, 0x5D, 0x03, 0x69, 0x03, 0x70, 0x03, 0x77, 0x03, 0x7E, 0x03,
+    0x86, 0x03, 0x8C, 0x03, 0x93, 0x03, 0x9A, 0x03, 0xA4, 0x03, 0xAD, 0x03,
+    0xB6, 0x03, 0xBD, 0x03, 0xCC, 0x03, 0xD5, 0x03, 0xDC, 0x03, 0xE3, 0x03,
+    0xEA, 0x03, 0xF5, 0x03, 0x00, 0x04, 0x0D, 0x04, 0x14, 0x04, 0x18, 0x04,
+    0x1F, 0x04, 0x26, 0x04,
+    /* ' ' */
+    0x03, 0xC0,
+    /* '!' */
+    0x02, 0x05, 0x09, 0x48,
+    /* '"' */
+    0x04, 0x03, 0x6B, 0x68,
+    /* '#' */
+    0x06, 0x11, 0x09, 0x1F, 0x19, 0x09, 0x1F, 0x19, 0x09, 0x58,
+    /* '$' */
+    0x06, 0x11, 0x11, 0x19, 0x09, 0x09, 0x17, 0x11, 0x09, 0x09, 0x19, 0x11,
+    0x58,
+    /* '%' */
+    0x06, 0x02, 0x19, 0x12, 0x11, 0x31, 0x31, 0x12, 0x11, 0x1A, 0x48,
+    /* '&' */
+    0x06, 0x0A, 0x0A, 0x11, 0x11, 0x11, 0x12, 0x09, 0x09, 0x31, 0x31, 0x09,
+    0x48,
+    /* ''' */
+    0x04, 0x19, 0x23, 0x2A, 0x70,
+    /* '(' */
+    0x04, 0x13, 0x21, 0x19, 0x11, 0x29, 0x48,
+    /* ')' */
+    0x04, 0x01, 0x29, 0x11, 0x19, 0x23, 0x58,
+    /* '*' */
+    0x06, 0x09, 0x09, 0x09, 0x23, 0x1F, 0x1B, 0x21, 0x09, 0x09, 0x50,
+    /* '+' */
+    0x06, 0x19, 0x39, 0x2D, 0x29, 0x39, 0x60,
+    /* ',' */
+    0x04, 0x39, 0x23, 0x2A, 0x50,
+    /* '-' */
+    0x06, 0x19, 0x39, 0x39, 0x39, 0x39, 0x60,
+    /* '.' */
+    0x03, 0x2A, 0x32, 0x48,
+    /* '/' */
+    0x06, 0x29, 0x31, 0x31, 0x31, 0x31, 0x70,
+    /* '0' */
+    0x06, 0x0D, 0x11, 0x19, 0x09, 0x09, 0x11, 0x11, 0x09, 0x09, 0x19, 0x15,
+    0x50,
+    /* '1' */
+    0x04, 0x09, 0x21, 0x0F, 0x39, 0x48,
+    /* '2' */
+    0x06, 0x09, 0x13, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11,
+    0x12, 0x19, 0x48,
+    /* '3' */
+    0x06, 0x01, 0x21, 0x11, 0x29, 0x09, 0x11, 0x11, 0x09, 0x0A, 0x11, 0x0A,
+    0x12, 0x50,
+    /* '4' */
+    0x06, 0x1A, 0x29, 0x09, 0x21, 0x11, 0x1F, 0x29, 0x58,
+    /* '5' */
+    0x06, 0x03, 0x11, 0x11, 0x09, 0x19, 0x09, 0x09, 0x19, 0x09, 0x09, 0x19,
+    0x09, 0x13, 0x50,
+    /* '6' */
+    0x06, 0x14, 0x19, 0x09, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09,
+    0x1A, 0x50,
+    /* '7' */
+    0x06, 0x01, 0x29, 0x09, 0x21, 0x11, 0x19, 0x19, 0x11, 0x23, 0x68,
+    /* '8' */
+    0x06, 0x0A, 0x0A, 0x11, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11,
+    0x12, 0x0A, 0x50,
+    /* '9' */
+    0x06, 0x0A, 0x19, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x09,
+    0x1C, 0x58,
+    /* ':' */
+    0x02, 0x11, 0x09, 0x58,
+    /* ';' */
+    0x03, 0x31, 0x19, 0x0A, 0x50,
+    /* '<' */
+    0x05, 0x19, 0x31, 0x09, 0x21, 0x19, 0x11, 0x29, 0x48,
+    /* '=' */
+    0x06, 0x11, 0x09, 0x29, 0x09, 0x29, 0x09, 0x29, 0x09, 0x29, 0x09, 0x58,
+    /* '>' */
+    0x05, 0x01, 0x29, 0x11, 0x19, 0x21, 0x09, 0x31, 0x60,
+    /* '?' */
+    0x06, 0x09, 0x31, 0x39, 0x12, 0x09, 0x09, 0x11, 0x2A, 0x68,
+    /* '@' */
+    0x06, 0x0D, 0x11, 0x29, 0x09, 0x0B, 0x09, 0x09, 0x12, 0x09, 0x13, 0x11,
+    0x48,
+    /* 'A' */
+    0x06, 0x15, 0x11, 0x11, 0x19, 0x19, 0x21, 0x11, 0x2D, 0x48,
+    /* 'B' */
+    0x06, 0x07, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x12,
+    0x0A, 0x50,
+    /* 'C' */
+    0x06, 0x0D, 0x11, 0x29, 0x09, 0x29, 0x09, 0x29, 0x11, 0x19, 0x50,
+    /* 'D' */
+    0x06, 0x07, 0x09, 0x29, 0x09, 0x29, 0x09, 0x29, 0x15, 0x50,
+    /* 'E' */
+    0x06, 0x07, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09,
+    0x29, 0x48,
+    /* 'F' */
+    0x06, 0x07, 0x09, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x78,
+    /* 'G' */
+    0x06, 0x0D, 0x11, 0x29, 0x09, 0x29, 0x09, 0x19, 0x09, 0x0A, 0x13, 0x48,
+    /* 'H' */
+    0x06, 0x07, 0x21, 0x39, 0x39, 0x27, 0x48,
+    /* 'I' */
+    0x04, 0x01, 0x29, 0x0F, 0x09, 0x29, 0x48,
+    /* 'J' */
+    0x06, 0x29, 0x41, 0x09, 0x29, 0x0E, 0x11, 0x78,
+    /* 'K' */
+    0x06, 0x07, 0x21, 0x31, 0x09, 0x21, 0x19, 0x11, 0x29, 0x48,
+    /* 'L' */
+    0x06, 0x07, 0x39, 0x39, 0x39, 0x39, 0x48,
+    /* 'M' */
+    0x06, 0x07, 0x11, 0x43, 0x21, 0x37, 0x48,
+    /* 'N' */
+    0x06, 0x07, 0x19, 0x41, 0x41, 0x1F, 0x48,
+    /* 'O' */
+    0x06, 0x0D, 0x11, 0x29, 0x09, 0x29, 0x09, 0x29, 0x15, 0x50,
+    /* 'P' */
+    0x06, 0x07, 0x09, 0x11, 0x21, 0x11, 0x21, 0x11, 0x2A, 0x68,
+    /* 'Q' */
+    0x06, 0x0D, 0x11, 0x29, 0x09, 0x19, 0x09, 0x09, 0x21, 0x1C, 0x09, 0x48,
+    /* 'R' */
+    0x06, 0x07, 0x09, 0x11, 0x21, 0x12, 0x19, 0x11, 0x09, 0x1A, 0x19, 0x48,
+    /* 'S' */
+    0x06, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x09, 0x11, 0x11, 0x09, 0x11, 0x11,
+    0x11, 0x12, 0x50,
+    /* 'T' */
+    0x06, 0x02, 0x31, 0x3F, 0x09, 0x3A, 0x70,
+    /* 'U' */
+    0x06, 0x06, 0x41, 0x39, 0x39, 0x0E, 0x50,
+    /* 'V' */
+    0x06, 0x05, 0x41, 0x41, 0x31, 0x15, 0x58,
+    /* 'W' */
+    0x06, 0x06, 0x41, 0x23, 0x41, 0x0E, 0x50,
+    /* 'X' */
+    0x06, 0x02, 0x1A, 0x19, 0x09, 0x31, 0x31, 0x09, 0x1A, 0x1A, 0x48,
+    /* 'Y' */
+    0x06, 0x02, 0x41, 0x44, 0x19, 0x2A, 0x70,
+    /* 'Z' */
+    0x06, 0x01, 0x22, 0x09, 0x12, 0x09, 0x09, 0x11, 0x11, 0x09, 0x0A, 0x11,
+    0x0A, 0x21, 0x48,
+    /* '[' */
+    0x05, 0x07, 0x09, 0x29, 0x09, 0x29, 0x09, 0x29, 0x48,
+    /* '\' */
+    0x06, 0x09, 0x41, 0x41, 0x41, 0x41, 0x50,
+    /* ']' */
+    0x05, 0x01, 0x29, 0x09, 0x29, 0x09, 0x29, 0x0F, 0x48,
+    /* '^' */
+    0x06, 0x11, 0x31, 0x31, 0x41, 0x41, 0x68,
+    /* '_' */
+    0x06, 0x31, 0x39, 0x39, 0x39, 0x39, 0x48,
+    /* '`' */
+    0x04, 0x02, 0x33, 0x41, 0x60,
+    /* 'a' */
+    0x06, 0x29, 0x21, 0x09, 0x09, 0x19, 0x09, 0x09, 0x24, 0x39, 0x48,
+    /* 'b' */
+    0x06, 0x07, 0x21, 0x09, 0x21, 0x19, 0x19, 0x19, 0x23, 0x50,
+    /* 'c' */
+    0x06, 0x1B, 0x21, 0x19, 0x19, 0x19, 0x19, 0x19, 0x21, 0x09, 0x50,
+    /* 'd' */
+    0x06, 0x1B, 0x21, 0x19, 0x19, 0x19, 0x21, 0x09, 0x17, 0x48,
+    /* 'e' */
+    0x06, 0x1B, 0x21, 0x09, 0x09, 0x19, 0x09, 0x09, 0x19, 0x09, 0x09, 0x22,
+    0x58,
+    /* 'f' */
+    0x05, 0x19, 0x2E, 0x09, 0x11, 0x29, 0x70,
+    /* 'g' */
+    0x06, 0x1A, 0x29, 0x11, 0x09, 0x11, 0x11, 0x09, 0x13, 0x11, 0x1C, 0x48,
+    /* 'h' */
+    0x06, 0x07, 0x21, 0x31, 0x39, 0x44, 0x48,
+    /* 'i' */
+    0x04, 0x11, 0x19, 0x09, 0x0D, 0x39, 0x48,
+    /* 'j' */
+    0x05, 0x29, 0x41, 0x39, 0x09, 0x0C, 0x50,
+    /* 'k' */
+    0x05, 0x07, 0x29, 0x31, 0x09, 0x21, 0x19, 0x48,
+    /* 'l' */
+    0x04, 0x01, 0x29, 0x0F, 0x39, 0x48,
+    /* 'm' */
+    0x06, 0x15, 0x19, 0x44, 0x19, 0x44, 0x48,
+    /* 'n' */
+    0x06, 0x15, 0x21, 0x31, 0x39, 0x44, 0x48,
+    /* 'o' */
+    0x06, 0x1B, 0x21, 0x19, 0x19, 0x19, 0x19, 0x19, 0x23, 0x50,
+    /* 'p' */
+    0x06, 0x16, 0x1A, 0x29, 0x11, 0x21, 0x11, 0x2A, 0x58,
+    /* 'q' */
+    0x06, 0x1A, 0x29, 0x11, 0x21, 0x11, 0x2A, 0x2E, 0x40,
+    /* 'r' */
+    0x06, 0x15, 0x21, 0x31, 0x39, 0x41, 0x60,
+    /* 's' */
+    0x06, 0x19, 0x11, 0x19, 0x09, 0x09, 0x19, 0x09, 0x09, 0x19, 0x09, 0x09,
+    0x19, 0x11, 0x50,
+    /* 't' */
+    0x06, 0x11, 0x39, 0x2E, 0x21, 0x19, 0x19, 0x11, 0x50,
+    /* 'u' */
+    0x06, 0x14, 0x41, 0x39, 0x31, 0x25, 0x48,
+    /* 'v' */
+    0x06, 0x13, 0x41, 0x41, 0x31, 0x23, 0x58,
+    /* 'w' */
+    0x06, 0x14, 0x41, 0x2A, 0x41, 0x1C, 0x50,
+    /* 'x' */
+    0x06, 0x11, 0x19, 0x21, 0x09, 0x31, 0x31, 0x09, 0x21, 0x19, 0x48,
+    /* 'y' */
+    0x06, 0x12, 0x11, 0x29, 0x11, 0x21, 0x11, 0x21, 0x11, 0x15, 0x48,
+    /* 'z' */
+    0x06, 0x11, 0x19, 0x19, 0x12, 0x19, 0x09, 0x09, 0x1A, 0x11, 0x19, 0x19,
+    0x48,
+    /* '{' */
+    0x04, 0x19, 0x2A, 0x0A, 0x11, 0x29, 0x48,
+    /* '|' */
+    0x02, 0x03, 0x0B, 0x48,
+    /* '}' */
+    0x04, 0x01, 0x29, 0x12, 0x0A, 0x29, 0x60,
+    /* '~' */
+    0x06, 0x09, 0x31, 0x41, 0x41, 0x31, 0x70,
+
+    /* System: 16 high, 1287 bytes */
+    0x10, 0x20, 0x7E, 0x03, 0xC4, 0x00, 0xC8, 0x00, 0xD0, 0x00, 0xD7, 0x00,
+    0xE7, 0x00, 0xF7, 0x00, 0x0B, 0x01, 0x1C, 0x01, 0x20, 0x01, 0x29, 0x01,
+    0x32, 0x01, 0x3F, 0x01, 0x47, 0x01, 0x4D, 0x01, 0x55, 0x01, 0x5A, 0x01,
+    0x62, 0x01, 0x70, 0x01, 0x79, 0x01, 0x89, 0x01, 0x99, 0x01, 0xA3, 0x01,
+    0xB3, 0x01, 0xBF, 0x01, 0xCA, 0x01, 0xDA, 0x01, 0xE6, 0x01, 0xEE, 0x01,
+    0xF7, 0x01, 0x03, 0x02, 0x11, 0x02, 0x1D, 0x02, 0x29, 0x02, 0x3E, 0x02,
+    0x4A, 0x02, 0x5A, 0x02, 0x67, 0x02, 0x73, 0x02, 0x84, 0x02, 0x91, 0x02,
+    0x9F, 0x02, 0xAB, 0x02, 0xB5, 0x02, 0xBF, 0x02, 0xCB, 0x02, 0xD5, 0x02,
+    0xE2, 0x02, 0xEF, 0x02, 0xFB, 0x02, 0x07, 0x03, 0x14, 0x03, 0x22, 0x03,
+    0x32, 0x03, 0x3C, 0x03, 0x48, 0x03, 0x52, 0x03, 0x5D, 0x03, 0x69, 0x03,
+    0x71, 0x03, 0x81, 0x03, 0x8B, 0x03, 0x93, 0x03, 0x9D, 0x03, 0xA5, 0x03,
+    0xAF, 0x03, 0xB3, 0x03, 0xC0, 0x03, 0xCC, 0x03, 0xD8, 0x03, 0xE4, 0x03,
+    0xF1, 0x03, 0xFE, 0x03, 0x0E, 0x04, 0x18, 0x04, 0x24, 0x04, 0x31, 0x04,
+    0x3D, 0x04, 0x49, 0x04, 0x52, 0x04, 0x5A, 0x04, 0x64, 0x04, 0x70, 0x04,
+    0x7C, 0x04, 0x84, 0x04, 0x94, 0x04, 0xA1, 0x04, 0xA9, 0x04, 0xB1, 0x04,
+    0xBA, 0x04, 0xC6, 0x04, 0xD3, 0x04, 0xE3, 0x04, 0xED, 0x04, 0xF3, 0x04,
+    0xFD, 0x04, 0x07, 0x05,
+    /* ' ' */
+    0x04, 0xF8, 0xF8, 0x10,
+    /* '!' */
+    0x05, 0x23, 0x66, 0x0A, 0x3E, 0x0A, 0x43, 0xC8,
+    /* '"' */
+    0x07, 0x1B, 0x6B, 0xF8, 0x73, 0x6B, 0xD0,
+    /* '#' */
+    0x08, 0x29, 0x19, 0x4F, 0x02, 0x3F, 0x02, 0x49, 0x19, 0x4F, 0x02, 0x3F,
+    0x02, 0x49, 0x19, 0xB0,
+    /* '$' */
+    0x07, 0x22, 0x21, 0x44, 0x1A, 0x2B, 0x12, 0x1B, 0x1B, 0x1A, 0x13, 0x2A,
+    0x1C, 0x41, 0x22, 0xA8,
+    /* '%' */
+    0x09, 0x1A, 0x6C, 0x1A, 0x39, 0x11, 0x12, 0x44, 0x0A, 0x0A, 0x3A, 0x0A,
+    0x0C, 0x42, 0x11, 0x11, 0x3A, 0x1C, 0x6A, 0xA0,
+    /* '&' */
+    0x08, 0x22, 0x0C, 0x47, 0x02, 0x39, 0x11, 0x21, 0x3C, 0x09, 0x11, 0x42,
+    0x13, 0x6C, 0x61, 0x11, 0xA0,
+    /* ''' */
+    0x03, 0x1B, 0x6B, 0xD0,
+    /* '(' */
+    0x05, 0x35, 0x4F, 0x02, 0x33, 0x2B, 0x29, 0x49, 0x90,
+    /* ')' */
+    0x05, 0x19, 0x49, 0x2B, 0x2B, 0x37, 0x02, 0x4D, 0xA8,
+    /* '*' */
+    0x08, 0x39, 0x69, 0x09, 0x09, 0x5D, 0x63, 0x65, 0x59, 0x09, 0x09, 0x69,
+    0xC0,
+    /* '+' */
+    0x07, 0x39, 0x79, 0x6D, 0x5D, 0x69, 0x79, 0xC0,
+    /* ',' */
+    0x04, 0x52, 0x09, 0x64, 0x63, 0x98,
+    /* '-' */
+    0x07, 0x39, 0x79, 0x79, 0x79, 0x79, 0x79, 0xC0,
+    /* '.' */
+    0x04, 0x52, 0x72, 0x72, 0xA0,
+    /* '/' */
+    0x07, 0x5A, 0x64, 0x54, 0x54, 0x54, 0x62, 0xD8,
+    /* '0' */
+    0x07, 0x27, 0x47, 0x02, 0x39, 0x22, 0x09, 0x39, 0x0A, 0x21, 0x3F, 0x02,
+    0x47, 0xA8,
+    /* '1' */
+    0x06, 0x29, 0x79, 0x72, 0x6F, 0x02, 0x3F, 0x02, 0xA0,
+    /* '2' */
+    0x07, 0x22, 0x22, 0x3B, 0x1B, 0x39, 0x22, 0x09, 0x39, 0x1A, 0x11, 0x3D,
+    0x19, 0x43, 0x21, 0xA0,
+    /* '3' */
+    0x07, 0x22, 0x1A, 0x43, 0x1B, 0x39, 0x19, 0x19, 0x39, 0x19, 0x19, 0x3F,
+    0x02, 0x43, 0x0B, 0xA8,
+    /* '4' */
+    0x08, 0x42, 0x4F, 0x4D, 0x09, 0x79, 0x5F, 0x4F, 0x69, 0xB0,
+    /* '5' */
+    0x07, 0x1D, 0x19, 0x3D, 0x19, 0x39, 0x19, 0x19, 0x39, 0x19, 0x12, 0x39,
+    0x1C, 0x41, 0x22, 0xB0,
+    /* '6' */
+    0x07, 0x35, 0x57, 0x3C, 0x21, 0x3A, 0x09, 0x21, 0x39, 0x16, 0x5C, 0xA8,
+    /* '7' */
+    0x07, 0x19, 0x79, 0x2B, 0x39, 0x1D, 0x39, 0x0C, 0x54, 0x62, 0xD8,
+    /* '8' */
+    0x07, 0x23, 0x0B, 0x47, 0x02, 0x39, 0x12, 0x19, 0x39, 0x1A, 0x11, 0x3F,
+    0x02, 0x43, 0x0B, 0xA8,
+    /* '9' */
+    0x07, 0x24, 0x5E, 0x11, 0x39, 0x21, 0x0A, 0x39, 0x24, 0x3F, 0x55, 0xB8,
+    /* ':' */
+    0x04, 0x2A, 0x1A, 0x4A, 0x1A, 0x4A, 0x1A, 0xA0,
+    /* ';' */
+    0x04, 0x2A, 0x1A, 0x09, 0x3A, 0x1C, 0x3A, 0x1B, 0x98,
+    /* '<' */
+    0x07, 0x39, 0x73, 0x62, 0x0A, 0x52, 0x1A, 0x42, 0x2A, 0x39, 0x39, 0xA0,
+    /* '=' */
+    0x07, 0x31, 0x09, 0x69, 0x09, 0x69, 0x09, 0x69, 0x09, 0x69, 0x09, 0x69,
+    0x09, 0xB8,
+    /* '>' */
+    0x07, 0x19, 0x39, 0x3A, 0x2A, 0x42, 0x1A, 0x52, 0x0A, 0x63, 0x71, 0xC0,
+    /* '?' */
+    0x07, 0x22, 0x6B, 0x69, 0x1A, 0x0A, 0x39, 0x13, 0x0A, 0x3C, 0x6A, 0xD0,
+    /* '@' */
+    0x09, 0x27, 0x47, 0x02, 0x39, 0x39, 0x39, 0x1A, 0x11, 0x39, 0x14, 0x09,
+    0x39, 0x11, 0x11, 0x09, 0x3F, 0x09, 0x46, 0x09, 0xA0,
+    /* 'A' */
+    0x07, 0x2F, 0x47, 0x01, 0x3A, 0x19, 0x52, 0x19, 0x5F, 0x01, 0x4F, 0xA0,
+    /* 'B' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x19, 0x19, 0x39, 0x19, 0x19, 0x3F,
+    0x02, 0x43, 0x0B, 0xA8,
+    /* 'C' */
+    0x07, 0x27, 0x47, 0x02, 0x39, 0x39, 0x39, 0x39, 0x3B, 0x1B, 0x42, 0x1A,
+    0xA8,
+    /* 'D' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x39, 0x3A, 0x2A, 0x47, 0x55, 0xB0,
+    /* 'E' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x19, 0x19, 0x39, 0x19, 0x19, 0x39,
+    0x19, 0x19, 0x39, 0x39, 0xA0,
+    /* 'F' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x19, 0x59, 0x19, 0x59, 0x19, 0x59,
+    0xE0,
+    /* 'G' */
+    0x07, 0x27, 0x47, 0x02, 0x39, 0x39, 0x39, 0x21, 0x11, 0x3B, 0x14, 0x42,
+    0x14, 0xA0,
+    /* 'H' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x59, 0x79, 0x5F, 0x02, 0x3F, 0x02, 0xA0,
+    /* 'I' */
+    0x05, 0x19, 0x39, 0x3F, 0x02, 0x3F, 0x02, 0x39, 0x39, 0xA0,
+    /* 'J' */
+    0x07, 0x4A, 0x73, 0x79, 0x79, 0x3F, 0x02, 0x3F, 0x01, 0xA8,
+    /* 'K' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x59, 0x6D, 0x4C, 0x0C, 0x3A, 0x2A, 0xA0,
+    /* 'L' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x79, 0x79, 0x79, 0x79, 0xA0,
+    /* 'M' */
+    0x08, 0x1F, 0x02, 0x3F, 0x02, 0x49, 0x83, 0x61, 0x6F, 0x02, 0x3F, 0x02,
+    0xA0,
+    /* 'N' */
+    0x08, 0x1F, 0x02, 0x3F, 0x02, 0x4A, 0x7A, 0x7A, 0x57, 0x02, 0x3F, 0x02,
+    0xA0,
+    /* 'O' */
+    0x07, 0x27, 0x47, 0x02, 0x39, 0x39, 0x39, 0x39, 0x3F, 0x02, 0x47, 0xA8,
+    /* 'P' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x19, 0x59, 0x19, 0x5D, 0x63, 0xC8,
+    /* 'Q' */
+    0x07, 0x27, 0x47, 0x02, 0x39, 0x39, 0x39, 0x3A, 0x37, 0x04, 0x37, 0x11,
+    0x90,
+    /* 'R' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x39, 0x19, 0x59, 0x1A, 0x57, 0x02, 0x43,
+    0x13, 0xA0,
+    /* 'S' */
+    0x07, 0x22, 0x21, 0x44, 0x1A, 0x39, 0x12, 0x19, 0x39, 0x1A, 0x11, 0x3A,
+    0x1C, 0x41, 0x22, 0xA8,
+    /* 'T' */
+    0x07, 0x19, 0x79, 0x7F, 0x02, 0x3F, 0x02, 0x39, 0x79, 0xE0,
+    /* 'U' */
+    0x07, 0x1F, 0x01, 0x47, 0x02, 0x79, 0x79, 0x3F, 0x02, 0x3F, 0x01, 0xA8,
+    /* 'V' */
+    0x07, 0x1F, 0x4F, 0x01, 0x7A, 0x72, 0x3F, 0x01, 0x47, 0xB0,
+    /* 'W' */
+    0x08, 0x1E, 0x57, 0x02, 0x6B, 0x53, 0x83, 0x3F, 0x02, 0x3E, 0xB8,
+    /* 'X' */
+    0x07, 0x1A, 0x23, 0x3B, 0x14, 0x4B, 0x73, 0x53, 0x14, 0x3A, 0x23, 0xA0,
+    /* 'Y' */
+    0x07, 0x1C, 0x65, 0x7D, 0x5D, 0x3D, 0x5C, 0xC8,
+    /* 'Z' */
+    0x07, 0x19, 0x2B, 0x39, 0x24, 0x39, 0x1A, 0x11, 0x39, 0x12, 0x19, 0x3C,
+    0x21, 0x3B, 0x29, 0xA0,
+    /* '[' */
+    0x05, 0x1F, 0x05, 0x27, 0x05, 0x21, 0x51, 0x21, 0x51, 0x88,
+    /* '\' */
+    0x07, 0x1A, 0x74, 0x74, 0x74, 0x74, 0x72, 0x98,
+    /* ']' */
+    0x05, 0x19, 0x51, 0x21, 0x51, 0x27, 0x05, 0x27, 0x05, 0x88,
+    /* '^' */
+    0x07, 0x19, 0x72, 0x6A, 0x72, 0x7A, 0x79, 0xE0,
+    /* '_' */
+    0x09, 0x71, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x88,
+    /* '`' */
+    0x03, 0x1B, 0x6B, 0xD0,
+    /* 'a' */
+    0x07, 0x4A, 0x51, 0x14, 0x49, 0x11, 0x11, 0x49, 0x11, 0x11, 0x4F, 0x56,
+    0xA0,
+    /* 'b' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x49, 0x29, 0x49, 0x29, 0x4F, 0x55, 0xA8,
+    /* 'c' */
+    0x07, 0x35, 0x57, 0x49, 0x29, 0x49, 0x29, 0x4A, 0x1A, 0x51, 0x19, 0xA8,
+    /* 'd' */
+    0x07, 0x35, 0x57, 0x49, 0x29, 0x49, 0x29, 0x3F, 0x02, 0x3F, 0x02, 0xA0,
+    /* 'e' */
+    0x07, 0x35, 0x57, 0x49, 0x11, 0x11, 0x49, 0x11, 0x11, 0x4C, 0x11, 0x53,
+    0xB8,
+    /* 'f' */
+    0x07, 0x39, 0x67, 0x01, 0x3F, 0x02, 0x39, 0x19, 0x59, 0x19, 0x59, 0x19,
+    0xC0,
+    /* 'g' */
+    0x07, 0x35, 0x19, 0x37, 0x11, 0x31, 0x29, 0x11, 0x31, 0x29, 0x11, 0x37,
+    0x03, 0x37, 0x02, 0x90,
+    /* 'h' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x49, 0x79, 0x7F, 0x56, 0xA0,
+    /* 'i' */
+    0x07, 0x29, 0x29, 0x49, 0x29, 0x32, 0x0F, 0x32, 0x0F, 0x79, 0x79, 0xA0,
+    /* 'j' */
+    0x06, 0x71, 0x31, 0x41, 0x31, 0x41, 0x1A, 0x0F, 0x03, 0x1A, 0x0F, 0x02,
+    0x90,
+    /* 'k' */
+    0x07, 0x1F, 0x02, 0x3F, 0x02, 0x61, 0x73, 0x5B, 0x0B, 0x4A, 0x1A, 0xA0,
+    /* 'l' */
+    0x07, 0x19, 0x39, 0x39, 0x39, 0x3F, 0x02, 0x3F, 0x02, 0x79, 0x79, 0xA0,
+    /* 'm' */
+    0x08, 0x2F, 0x4F, 0x49, 0x7E, 0x51, 0x7F, 0x56, 0xA0,
+    /* 'n' */
+    0x07, 0x2F, 0x4F, 0x49, 0x79, 0x7F, 0x56, 0xA0,
+    /* 'o' */
+    0x07, 0x35, 0x57, 0x49, 0x29, 0x49, 0x29, 0x4F, 0x55, 0xA8,
+    /* 'p' */
+    0x07, 0x2F, 0x03, 0x37, 0x03, 0x31, 0x29, 0x49, 0x29, 0x4F, 0x55, 0xA8,
+    /* 'q' */
+    0x07, 0x35, 0x57, 0x49, 0x29, 0x49, 0x29, 0x4F, 0x03, 0x37, 0x03, 0x88,
+    /* 'r' */
+    0x07, 0x2F, 0x4F, 0x59, 0x71, 0x72, 0x72, 0xC8,
+    /* 's' */
+    0x07, 0x32, 0x19, 0x4C, 0x11, 0x49, 0x11, 0x11, 0x49, 0x11, 0x11, 0x49,
+    0x14, 0x49, 0x1A, 0xA8,
+    /* 't' */
+    0x07, 0x29, 0x6F, 0x01, 0x47, 0x02, 0x49, 0x29, 0x49, 0x29, 0x49, 0x29,
+    0xA0,
+    /* 'u' */
+    0x07, 0x2E, 0x57, 0x79, 0x79, 0x4F, 0x4F, 0xA0,
+    /* 'v' */
+    0x07, 0x2D, 0x5E, 0x7A, 0x72, 0x4E, 0x55, 0xB0,
+    /* 'w' */
+    0x08, 0x2D, 0x5F, 0x72, 0x54, 0x82, 0x4F, 0x4D, 0xB0,
+    /* 'x' */
+    0x07, 0x2A, 0x1A, 0x4B, 0x0B, 0x5B, 0x6B, 0x5B, 0x0B, 0x4A, 0x1A, 0xA0,
+    /* 'y' */
+    0x08, 0x71, 0x36, 0x19, 0x37, 0x11, 0x61, 0x0A, 0x63, 0x3F, 0x01, 0x46,
+    0xA8,
+    /* 'z' */
+    0x07, 0x29, 0x22, 0x49, 0x1B, 0x49, 0x12, 0x09, 0x49, 0x0A, 0x11, 0x4B,
+    0x19, 0x4A, 0x21, 0xA0,
+    /* '{' */
+    0x06, 0x41, 0x73, 0x54, 0x0C, 0x34, 0x1C, 0x29, 0x49, 0x90,
+    /* '|' */
+    0x03, 0x1F, 0x05, 0x27, 0x05, 0x88,
+    /* '}' */
+    0x06, 0x19, 0x49, 0x2C, 0x1C, 0x34, 0x0C, 0x53, 0x71, 0xB8,
+    /* '~' */
+    0x09, 0x22, 0x6A, 0x71, 0x7A, 0x7A, 0x79, 0x72, 0x6A, 0xD8,
+
+    /* Smooth: 16 high, anti-aliased, 3289 bytes */
+    0x10, 0x20, 0x7E, 0x00, 0xC4, 0x00, 0xC9, 0x00, 0xE4, 0x00, 0xF9, 0x00,
+    0x24, 0x01, 0x5F, 0x01, 0xA2, 0x01, 0xD2, 0x01, 0xDD, 0x01, 0xFC, 0x01,
+    0x1B, 0x02, 0x3A, 0x02, 0x51, 0x02, 0x60, 0x02, 0x6F, 0x02, 0x78, 0x02,
+    0x99, 0x02, 0xC2, 0x02, 0xD7, 0x02, 0x0B, 0x03, 0x3E, 0x03, 0x5E, 0x03,
+    0x89, 0x03, 0xB4, 0x03, 0xD6, 0x03, 0x09, 0x04, 0x34, 0x04, 0x43, 0x04,
+    0x58, 0x04, 0x83, 0x04, 0x9E, 0x04, 0xC9, 0x04, 0xEF, 0x04, 0x26, 0x05,
+    0x4D, 0x05, 0x78, 0x05, 0xA1, 0x05, 0xC2, 0x05, 0xE5, 0x05, 0x00, 0x06,
+    0x28, 0x06, 0x43, 0x06, 0x56, 0x06, 0x70, 0x06, 0x95, 0x06, 0xA8, 0x06,
+    0xC8, 0x06, 0xE9, 0x06, 0x0C, 0x07, 0x2D, 0x07, 0x55, 0x07, 0x7B, 0x07,
+    0xAC, 0x07, 0xBF, 0x07, 0xDA, 0x07, 0xF9, 0x07, 0x1C, 0x08, 0x4F, 0x08,
+    0x6E, 0x08, 0x9B, 0x08, 0xAE, 0x08, 0xCF, 0x08, 0xE2, 0x08, 0xFB, 0x08,
+    0x0E, 0x09, 0x19, 0x09, 0x3A, 0x09, 0x5B, 0x09, 0x7E, 0x09, 0x9F, 0x09,
+    0xC2, 0x09, 0xE1, 0x09, 0x0A, 0x0A, 0x25, 0x0A, 0x40, 0x0A, 0x5B, 0x0A,
+    0x80, 0x0A, 0x97, 0x0A, 0xB3, 0x0A, 0xCC, 0x0A, 0xEF, 0x0A, 0x10, 0x0B,
+    0x31, 0x0B, 0x49, 0x0B, 0x70, 0x0B, 0x8F, 0x0B, 0xA8, 0x0B, 0xC7, 0x0B,
+    0xE6, 0x0B, 0x11, 0x0C, 0x38, 0x0C, 0x63, 0x0C, 0x8A, 0x0C, 0x95, 0x0C,
+    0xBC, 0x0C, 0xD9, 0x0C,
+    /* ' ' */
+    0x04, 0x0F, 0x0F, 0x0F, 0x0F,
+    /* '!' */
+    0x05, 0x02, 0x30, 0xB0, 0xF0, 0xB0, 0x40, 0x0A, 0xB0, 0xF3, 0xA0, 0x00,
+    0xA1, 0x06, 0xB0, 0xF3, 0xA0, 0x00, 0xA1, 0x06, 0x30, 0xB0, 0xF0, 0xB0,
+    0x40, 0x0F, 0x07,
+    /* '"' */
+    0x07, 0x02, 0xA0, 0xF0, 0xA0, 0x0C, 0xA0, 0xF0, 0xA0, 0x0F, 0x0F, 0x0C,
+    0xA0, 0xF0, 0xA0, 0x0C, 0xA0, 0xF0, 0xA0, 0x0F, 0x09,
+    /* '#' */
+    0x08, 0x03, 0x50, 0xD0, 0x50, 0x00, 0x50, 0xD0, 0x50, 0x07, 0xA0, 0xF6,
+    0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x07, 0x20, 0xF0, 0x20, 0x00, 0x20, 0xF0,
+    0x20, 0x07, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x07, 0x50, 0xD0,
+    0x50, 0x00, 0x50, 0xD0, 0x50, 0x0F, 0x04,
+    /* '$' */
+    0x07, 0x02, 0x30, 0xB1, 0x30, 0x02, 0xD0, 0x40, 0x05, 0x40, 0xC0, 0xF1,
+    0xC0, 0x30, 0x01, 0xB0, 0xC0, 0x40, 0x03, 0xA0, 0xF1, 0x50, 0x40, 0xC1,
+    0x30, 0x00, 0x40, 0xF1, 0xA0, 0x02, 0xA0, 0xF1, 0x40, 0x00, 0x30, 0xC1,
+    0x40, 0x50, 0xF1, 0xA0, 0x03, 0x40, 0xC0, 0xB0, 0x01, 0x30, 0xC0, 0xF1,
+    0xC0, 0x40, 0x05, 0x40, 0xD0, 0x02, 0x30, 0xB1, 0x30, 0x0F, 0x03,
+    /* '%' */
+    0x09, 0x01, 0x30, 0xB1, 0x30, 0x0B, 0xB0, 0xF1, 0xB0, 0x01, 0x30, 0xB0,
+    0xD0, 0x06, 0xF0, 0x21, 0xF0, 0x00, 0x30, 0xC0, 0xA0, 0x10, 0x06, 0xB0,
+    0xF1, 0xA0, 0x10, 0xB0, 0xA0, 0x20, 0xA0, 0xB0, 0x30, 0x04, 0x30, 0xB0,
+    0xA0, 0x20, 0xA0, 0xB0, 0x10, 0xA0, 0xF1, 0xB0, 0x06, 0x10, 0xA0, 0xC0,
+    0x30, 0x00, 0xF0, 0x21, 0xF0, 0x06, 0xD0, 0xB0, 0x30, 0x01, 0xB0, 0xF1,
+    0xB0, 0x0B, 0x30, 0xB1, 0x30, 0x0F, 0x02,
+    /* '&' */
+    0x08, 0x02, 0x30, 0xB0, 0xA0, 0x20, 0xA0, 0xF1, 0xB0, 0x30, 0x06, 0xB0,
+    0xF6, 0xB0, 0x06, 0xF0, 0x21, 0xF0, 0x50, 0x01, 0x50, 0xF0, 0x06, 0xB0,
+    0xF1, 0xB0, 0x00, 0xD0, 0x50, 0x60, 0xE0, 0x06, 0x30, 0xB1, 0x30, 0x00,
+    0xF1, 0x90, 0x10, 0x0B, 0xF2, 0xA0, 0x0B, 0xD0, 0x51, 0xD0, 0x0F, 0x03,
+    /* ''' */
+    0x03, 0x02, 0xA0, 0xF0, 0xA0, 0x0C, 0xA0, 0xF0, 0xA0, 0x0F, 0x09,
+    /* '(' */
+    0x05, 0x04, 0x40, 0xB0, 0xF2, 0xB0, 0x40, 0x06, 0x30, 0xB0, 0xF6, 0xB0,
+    0x30, 0x04, 0xB0, 0xF0, 0xB0, 0x40, 0x02, 0x40, 0xB0, 0xF0, 0xB0, 0x04,
+    0xD0, 0x50, 0x06, 0x50, 0xD0, 0x0F, 0x01,
+    /* ')' */
+    0x05, 0x02, 0xD0, 0x50, 0x06, 0x50, 0xD0, 0x04, 0xB0, 0xF0, 0xB0, 0x40,
+    0x02, 0x40, 0xB0, 0xF0, 0xB0, 0x04, 0x30, 0xB0, 0xF6, 0xB0, 0x30, 0x06,
+    0x40, 0xB0, 0xF2, 0xB0, 0x40, 0x0F, 0x03,
+    /* '*' */
+    0x08, 0x06, 0xD0, 0x0C, 0xD0, 0x20, 0xF0, 0x20, 0xD0, 0x0A, 0xA0, 0xF2,
+    0xA0, 0x0A, 0x20, 0xF2, 0x20, 0x0A, 0xA0, 0xF2, 0xA0, 0x0A, 0xD0, 0x20,
+    0xF0, 0x20, 0xD0, 0x0C, 0xD0, 0x0F, 0x07,
+    /* '+' */
+    0x07, 0x06, 0xD0, 0x0D, 0x50, 0xF0, 0x50, 0x0B, 0xA0, 0xF2, 0xA0, 0x0A,
+    0xA0, 0xF2, 0xA0, 0x0B, 0x50, 0xF0, 0x50, 0x0D, 0xD0, 0x0F, 0x07,
+    /* ',' */
+    0x04, 0x09, 0xA1, 0x20, 0xD0, 0x0B, 0xF2, 0xB0, 0x0B, 0xA0, 0xF0, 0xB0,
+    0x30, 0x0F, 0x01,
+    /* '-' */
+    0x07, 0x06, 0xD0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E,
+    0xD0, 0x0F, 0x07,
+    /* '.' */
+    0x04, 0x09, 0xA1, 0x0D, 0xF1, 0x0D, 0xA1, 0x0F, 0x03,
+    /* '/' */
+    0x07, 0x09, 0x40, 0xB0, 0xA0, 0x0A, 0x40, 0xB0, 0xF1, 0xA0, 0x08, 0x40,
+    0xB0, 0xF1, 0xB0, 0x40, 0x07, 0x40, 0xB0, 0xF1, 0xB0, 0x40, 0x08, 0xA0,
+    0xF1, 0xB0, 0x40, 0x0A, 0xA0, 0xB0, 0x40, 0x0F, 0x09,
+    /* '0' */
+    0x07, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x01, 0x40, 0xB0, 0xA0, 0x20, 0xF0, 0x06, 0xF0, 0x20, 0xA0,
+    0xB0, 0x40, 0x01, 0x50, 0xF0, 0x06, 0xB0, 0xF6, 0xB0, 0x06, 0x30, 0xB0,
+    0xF4, 0xB0, 0x30, 0x0F, 0x03,
+    /* '1' */
+    0x06, 0x04, 0xD0, 0x0D, 0x40, 0xF0, 0x0C, 0x30, 0xC0, 0xF0, 0x50, 0x0B,
+    0xB0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x0F, 0x03,
+    /* '2' */
+    0x07, 0x02, 0x30, 0xB0, 0xA0, 0x02, 0x30, 0xB0, 0xA0, 0x06, 0xB0, 0xF0,
+    0xA0, 0x01, 0x30, 0xC0, 0xF1, 0x06, 0xF0, 0x50, 0x01, 0x30, 0xC0, 0xB0,
+    0x20, 0xF0, 0x06, 0xF0, 0x50, 0x00, 0x40, 0xC1, 0x30, 0x00, 0xF0, 0x06,
+    0xB0, 0xF2, 0xC0, 0x30, 0x01, 0xF0, 0x06, 0x30, 0xB0, 0xF0, 0xB0, 0x30,
+    0x02, 0xD0, 0x0F, 0x03,
+    /* '3' */
+    0x07, 0x02, 0x30, 0xB0, 0xA0, 0x02, 0xA0, 0xB0, 0x30, 0x06, 0xB0, 0xF0,
+    0xA0, 0x02, 0xA0, 0xF0, 0xB0, 0x06, 0xF0, 0x50, 0x01, 0xD0, 0x01, 0x50,
+    0xF0, 0x06, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x06,
+    0xB0, 0xF6, 0xB0, 0x06, 0x30, 0xB0, 0xF0, 0xA0, 0x20, 0xA0, 0xF0, 0xB0,
+    0x30, 0x0F, 0x03,
+    /* '4' */
+    0x08, 0x06, 0x40, 0xB0, 0xA0, 0x08, 0xA0, 0xF5, 0x08, 0xA0, 0xF2, 0xA0,
+    0x20, 0xF0, 0x0D, 0x50, 0xF0, 0x50, 0x09, 0xA0, 0xF4, 0xA0, 0x08, 0xA0,
+    0xF4, 0xA0, 0x0B, 0x50, 0xD0, 0x50, 0x0F, 0x04,
+    /* '5' */
+    0x07, 0x02, 0xA0, 0xF2, 0xA0, 0x02, 0xD0, 0x06, 0xF4, 0x02, 0xF0, 0x06,
+    0xF0, 0x50, 0x00, 0x50, 0xF0, 0x01, 0x40, 0xF0, 0x06, 0xF0, 0x02, 0xF0,
+    0x50, 0x40, 0xC0, 0xB0, 0x06, 0xF0, 0x02, 0xB0, 0xF1, 0xC0, 0x30, 0x06,
+    0xD0, 0x02, 0x30, 0xB1, 0x30, 0x0F, 0x04,
+    /* '6' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x07, 0x40, 0xC0, 0xF4, 0xB0,
+    0x06, 0xA0, 0xF2, 0x50, 0x01, 0x50, 0xF0, 0x06, 0xF0, 0xB0, 0x20, 0xF0,
+    0x50, 0x01, 0x50, 0xF0, 0x06, 0xD0, 0x40, 0x00, 0xB0, 0xF3, 0xB0, 0x09,
+    0x30, 0xB0, 0xF1, 0xB0, 0x30, 0x0F, 0x03,
+    /* '7' */
+    0x07, 0x02, 0xD0, 0x0E, 0xF0, 0x03, 0x40, 0xB0, 0xF0, 0xA0, 0x06, 0xF0,
+    0x01, 0x40, 0xB0, 0xF2, 0xA0, 0x06, 0xF0, 0x20, 0xA0, 0xF1, 0xB0, 0x40,
+    0x08, 0xF2, 0xB0, 0x40, 0x0A, 0xA0, 0xB0, 0x40, 0x0F, 0x09,
+    /* '8' */
+    0x07, 0x02, 0x30, 0xB0, 0xF0, 0xA0, 0x20, 0xA0, 0xF0, 0xB0, 0x30, 0x06,
+    0xB0, 0xF6, 0xB0, 0x06, 0xF0, 0x50, 0x40, 0xB0, 0xF0, 0x20, 0x00, 0x50,
+    0xF0, 0x06, 0xF0, 0x50, 0x00, 0x20, 0xF0, 0xB0, 0x40, 0x50, 0xF0, 0x06,
+    0xB0, 0xF6, 0xB0, 0x06, 0x30, 0xB0, 0xF0, 0xA0, 0x20, 0xA0, 0xF0, 0xB0,
+    0x30, 0x0F, 0x03,
+    /* '9' */
+    0x07, 0x02, 0x30, 0xB0, 0xF1, 0xB0, 0x30, 0x09, 0xB0, 0xF3, 0xB0, 0x00,
+    0x40, 0xD0, 0x06, 0xF0, 0x50, 0x01, 0x50, 0xF0, 0x20, 0xB0, 0xF0, 0x06,
+    0xF0, 0x50, 0x01, 0x50, 0xF2, 0xA0, 0x06, 0xB0, 0xF4, 0xC0, 0x40, 0x07,
+    0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x05,
+    /* ':' */
+    0x04, 0x04, 0xA1, 0x02, 0xA1, 0x08, 0xF1, 0x02, 0xF1, 0x08, 0xA1, 0x02,
+    0xA1, 0x0F, 0x03,
+    /* ';' */
+    0x04, 0x04, 0xA1, 0x02, 0xA1, 0x20, 0xD0, 0x06, 0xF1, 0x02, 0xF2, 0xB0,
+    0x06, 0xA1, 0x02, 0xA0, 0xF0, 0xB0, 0x30, 0x0F, 0x01,
+    /* '<' */
+    0x07, 0x05, 0x40, 0xD0, 0x40, 0x0B, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x09,
+    0x30, 0xC0, 0xB0, 0x20, 0xB0, 0xC0, 0x30, 0x07, 0x30, 0xC1, 0x30, 0x00,
+    0x30, 0xC1, 0x30, 0x06, 0xB0, 0xC0, 0x30, 0x02, 0x30, 0xC0, 0xB0, 0x06,
+    0xD0, 0x40, 0x04, 0x40, 0xD0, 0x0F, 0x03,
+    /* '=' */
+    0x07, 0x05, 0xD0, 0x00, 0xD0, 0x0C, 0xF0, 0x00, 0xF0, 0x0C, 0xF0, 0x00,
+    0xF0, 0x0C, 0xF0, 0x00, 0xF0, 0x0C, 0xF0, 0x00, 0xF0, 0x0C, 0xD0, 0x00,
+    0xD0, 0x0F, 0x06,
+    /* '>' */
+    0x07, 0x02, 0xD0, 0x40, 0x04, 0x40, 0xD0, 0x06, 0xB0, 0xC0, 0x30, 0x02,
+    0x30, 0xC0, 0xB0, 0x06, 0x30, 0xC1, 0x30, 0x00, 0x30, 0xC1, 0x30, 0x07,
+    0x30, 0xC0, 0xB0, 0x20, 0xB0, 0xC0, 0x30, 0x09, 0x30, 0xC0, 0xF0, 0xC0,
+    0x30, 0x0B, 0x40, 0xD0, 0x40, 0x0F, 0x06,
+    /* '?' */
+    0x07, 0x02, 0x30, 0xB0, 0xA0, 0x0C, 0xB0, 0xF0, 0xA0, 0x0C, 0xF0, 0x50,
+    0x00, 0x30, 0xB0, 0xA0, 0x00, 0xA1, 0x06, 0xF0, 0x50, 0x40, 0xC0, 0xF0,
+    0xA0, 0x00, 0xA1, 0x06, 0xB0, 0xF1, 0xC0, 0x40, 0x0A, 0x30, 0xB1, 0x30,
+    0x0F, 0x08,
+    /* '@' */
+    0x09, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06, 0xF0, 0x01, 0x30, 0xB1, 0x30, 0x00,
+    0xF0, 0x06, 0xF0, 0x01, 0xB0, 0xF1, 0xB0, 0x00, 0xF0, 0x06, 0xF0, 0x51,
+    0xF0, 0x21, 0xF0, 0x00, 0xF0, 0x06, 0xB0, 0xF5, 0x00, 0xF0, 0x06, 0x30,
+    0xB0, 0xF3, 0xA0, 0x00, 0xD0, 0x0F, 0x03,
+    /* 'A' */
+    0x07, 0x03, 0x30, 0xB0, 0xF4, 0xA0, 0x06, 0x30, 0xC0, 0xF5, 0xA0, 0x06,
+    0xB0, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x50, 0x08, 0xB0, 0xF0, 0x50, 0x00,
+    0x50, 0xF0, 0x50, 0x08, 0x30, 0xC0, 0xF5, 0xA0, 0x07, 0x30, 0xB0, 0xF4,
+    0xA0, 0x0F, 0x03,
+    /* 'B' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF8, 0x06, 0xF0, 0x50, 0x00, 0x50,
+    0xF0, 0x50, 0x00, 0x50, 0xF0, 0x06, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x50,
+    0x00, 0x50, 0xF0, 0x06, 0xB0, 0xF6, 0xB0, 0x06, 0x30, 0xB0, 0xF0, 0xA0,
+    0x20, 0xA0, 0xF0, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'C' */
+    0x07, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06, 0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06,
+    0xB0, 0xF0, 0xA0, 0x02, 0xA0, 0xF0, 0xB0, 0x06, 0x30, 0xB0, 0xA0, 0x02,
+    0xA0, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'D' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF8, 0x06, 0xF0, 0x20, 0x04, 0x20,
+    0xF0, 0x06, 0xB1, 0x40, 0x02, 0x40, 0xB1, 0x06, 0x30, 0xC0, 0xF4, 0xC0,
+    0x30, 0x07, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x04,
+    /* 'E' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF8, 0x06, 0xF0, 0x50, 0x00, 0x50,
+    0xF0, 0x50, 0x00, 0x50, 0xF0, 0x06, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x06,
+    0xF0, 0x02, 0xD0, 0x02, 0xF0, 0x06, 0xD0, 0x06, 0xD0, 0x0F, 0x03,
+    /* 'F' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF7, 0xA0, 0x06, 0xF0, 0x50, 0x00,
+    0x50, 0xF0, 0x50, 0x09, 0xF0, 0x02, 0xF0, 0x0A, 0xF0, 0x02, 0xD0, 0x0A,
+    0xD0, 0x0F, 0x0B,
+    /* 'G' */
+    0x07, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06, 0xF0, 0x50, 0x02, 0xD0, 0x51, 0xF0,
+    0x06, 0xB0, 0xF0, 0xA0, 0x01, 0xF3, 0x06, 0x30, 0xB0, 0xA0, 0x01, 0xA0,
+    0xF1, 0xA0, 0x0F, 0x03,
+    /* 'H' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x09, 0x50, 0xF0,
+    0x50, 0x0C, 0x50, 0xF0, 0x50, 0x09, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6,
+    0xA0, 0x0F, 0x03,
+    /* 'I' */
+    0x05, 0x02, 0xD0, 0x50, 0x04, 0x50, 0xD0, 0x06, 0xF8, 0x06, 0xF8, 0x06,
+    0xD0, 0x50, 0x04, 0x50, 0xD0, 0x0F, 0x03,
+    /* 'J' */
+    0x07, 0x08, 0xA0, 0xB0, 0x30, 0x0C, 0xA0, 0xF0, 0xB0, 0x0D, 0x50, 0xF0,
+    0x0D, 0x50, 0xF0, 0x06, 0xA0, 0xF6, 0xB0, 0x06, 0xA0, 0xF5, 0xB0, 0x30,
+    0x0F, 0x03,
+    /* 'K' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x09, 0x20, 0xF0,
+    0x20, 0x0A, 0x40, 0xB0, 0xF2, 0xB0, 0x40, 0x07, 0xA0, 0xF1, 0xA0, 0x20,
+    0xA0, 0xF1, 0xA0, 0x06, 0xA0, 0xB0, 0x40, 0x02, 0x40, 0xB0, 0xA0, 0x0F,
+    0x03,
+    /* 'L' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF7, 0x0D, 0x50, 0xF0, 0x0E,
+    0xF0, 0x0E, 0xF0, 0x0E, 0xD0, 0x0F, 0x03,
+    /* 'M' */
+    0x08, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x07, 0x50, 0xD0,
+    0x20, 0x0D, 0x20, 0xD0, 0xF0, 0xD0, 0x0A, 0x50, 0xD0, 0x20, 0x0B, 0xA0,
+    0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x0F, 0x03,
+    /* 'N' */
+    0x08, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x07, 0x40, 0xC0,
+    0xF0, 0x20, 0x0C, 0x30, 0xB1, 0x30, 0x0C, 0x20, 0xF0, 0xC0, 0x40, 0x08,
+    0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x0F, 0x03,
+    /* 'O' */
+    0x07, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06, 0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06,
+    0xB0, 0xF6, 0xB0, 0x06, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'P' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF7, 0xA0, 0x06, 0xF0, 0x50, 0x00,
+    0x50, 0xF0, 0x50, 0x09, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x0A, 0xB0, 0xF2,
+    0xB0, 0x0A, 0x30, 0xB0, 0xF0, 0xB0, 0x30, 0x0F, 0x07,
+    /* 'Q' */
+    0x07, 0x02, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x06, 0xB0, 0xF6, 0xB0, 0x06,
+    0xF0, 0x50, 0x04, 0x50, 0xF0, 0x40, 0x05, 0xF0, 0x50, 0x04, 0x50, 0xF0,
+    0xC0, 0x30, 0x04, 0xB0, 0xF8, 0xB0, 0x04, 0x30, 0xB0, 0xF4, 0xB0, 0x40,
+    0x50, 0xD0, 0x0F, 0x01,
+    /* 'R' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xF7, 0xA0, 0x06, 0xF0, 0x50, 0x00,
+    0x50, 0xF0, 0x20, 0x09, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0xB0, 0x40, 0x08,
+    0xB0, 0xF6, 0xA0, 0x06, 0x30, 0xB0, 0xF0, 0xB0, 0x41, 0xB0, 0xF0, 0xA0,
+    0x0F, 0x03,
+    /* 'S' */
+    0x07, 0x02, 0x30, 0xB1, 0x30, 0x02, 0xD0, 0x40, 0x06, 0xB0, 0xF1, 0xC0,
+    0x30, 0x01, 0xB1, 0x06, 0xF0, 0x50, 0x40, 0xC1, 0x30, 0x00, 0x40, 0xF0,
+    0x06, 0xF0, 0x40, 0x00, 0x30, 0xC1, 0x40, 0x50, 0xF0, 0x06, 0xB1, 0x01,
+    0x30, 0xC0, 0xF1, 0xB0, 0x06, 0x40, 0xD0, 0x02, 0x30, 0xB1, 0x30, 0x0F,
+    0x03,
+    /* 'T' */
+    0x07, 0x02, 0xD0, 0x0E, 0xF0, 0x50, 0x0D, 0xF7, 0xA0, 0x06, 0xF7, 0xA0,
+    0x06, 0xF0, 0x50, 0x0D, 0xD0, 0x0F, 0x0B,
+    /* 'U' */
+    0x07, 0x02, 0xA0, 0xF5, 0xB0, 0x30, 0x06, 0xA0, 0xF6, 0xB0, 0x0D, 0x50,
+    0xF0, 0x0D, 0x50, 0xF0, 0x06, 0xA0, 0xF6, 0xB0, 0x06, 0xA0, 0xF5, 0xB0,
+    0x30, 0x0F, 0x03,
+    /* 'V' */
+    0x07, 0x02, 0xA0, 0xF4, 0xB0, 0x30, 0x07, 0xA0, 0xF5, 0xC0, 0x30, 0x0C,
+    0x50, 0xF0, 0xB0, 0x0C, 0x50, 0xF0, 0xB0, 0x06, 0xA0, 0xF5, 0xC0, 0x30,
+    0x06, 0xA0, 0xF4, 0xB0, 0x30, 0x0F, 0x04,
+    /* 'W' */
+    0x08, 0x02, 0xA0, 0xF3, 0xB0, 0x40, 0x08, 0xA0, 0xF6, 0xA0, 0x0B, 0x10,
+    0xA0, 0xF0, 0xA0, 0x09, 0xD0, 0xF0, 0xD0, 0x0E, 0x10, 0xA0, 0xF0, 0xA0,
+    0x06, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF3, 0xB0, 0x40, 0x0F, 0x05,
+    /* 'X' */
+    0x07, 0x02, 0xA0, 0xB0, 0x30, 0x01, 0x40, 0xB0, 0xF0, 0xA0, 0x06, 0xA0,
+    0xF0, 0xC0, 0x40, 0x60, 0xE0, 0xF1, 0xA0, 0x07, 0x40, 0xB0, 0xF0, 0x90,
+    0x10, 0x0B, 0x10, 0x90, 0xF0, 0xB0, 0x40, 0x08, 0xA0, 0xF0, 0xE0, 0x60,
+    0x40, 0xC0, 0xF1, 0xA0, 0x06, 0xA0, 0xB0, 0x40, 0x01, 0x30, 0xB0, 0xF0,
+    0xA0, 0x0F, 0x03,
+    /* 'Y' */
+    0x07, 0x02, 0xA0, 0xF1, 0xB0, 0x30, 0x0A, 0xA0, 0xF2, 0xC0, 0x40, 0x0C,
+    0x50, 0xF3, 0xA0, 0x09, 0x50, 0xF3, 0xA0, 0x06, 0xA0, 0xF2, 0xC0, 0x40,
+    0x09, 0xA0, 0xF1, 0xB0, 0x30, 0x0F, 0x07,
+    /* 'Z' */
+    0x07, 0x02, 0xD0, 0x03, 0x30, 0xB0, 0xF0, 0xA0, 0x06, 0xF0, 0x02, 0x30,
+    0xC0, 0xF2, 0x06, 0xF0, 0x01, 0x30, 0xC1, 0x40, 0x50, 0xF0, 0x06, 0xF0,
+    0x50, 0x40, 0xC1, 0x30, 0x01, 0xF0, 0x06, 0xF2, 0xC0, 0x30, 0x02, 0xF0,
+    0x06, 0xA0, 0xF0, 0xB0, 0x30, 0x03, 0xD0, 0x0F, 0x03,
+    /* '[' */
+    0x05, 0x02, 0xA0, 0xF9, 0xA0, 0x03, 0xFB, 0x03, 0xF0, 0x50, 0x07, 0x50,
+    0xF0, 0x03, 0xD0, 0x09, 0xD0, 0x0F, 0x00,
+    /* '\' */
+    0x07, 0x02, 0xA0, 0xB0, 0x40, 0x0C, 0xA0, 0xF1, 0xB0, 0x40, 0x0B, 0x40,
+    0xB0, 0xF1, 0xB0, 0x40, 0x0B, 0x40, 0xB0, 0xF1, 0xB0, 0x40, 0x0B, 0x40,
+    0xB0, 0xF1, 0xA0, 0x0C, 0x40, 0xB0, 0xA0, 0x0F, 0x02,
+    /* ']' */
+    0x05, 0x02, 0xD0, 0x09, 0xD0, 0x03, 0xF0, 0x50, 0x07, 0x50, 0xF0, 0x03,
+    0xFB, 0x03, 0xA0, 0xF9, 0xA0, 0x0F, 0x00,
+    /* '^' */
+    0x07, 0x01, 0x40, 0xD0, 0x0C, 0x30, 0xC0, 0xB0, 0x0C, 0xB0, 0xF0, 0x40,
+    0x0C, 0xB0, 0xF0, 0x40, 0x0C, 0x30, 0xC0, 0xB0, 0x0D, 0x40, 0xD0, 0x0F,
+    0x0B,
+    /* '_' */
+    0x09, 0x0D, 0xD0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E, 0xF0, 0x0E,
+    0xF0, 0x0E, 0xF0, 0x0E, 0xD0, 0x0F, 0x00,
+    /* '`' */
+    0x03, 0x02, 0xA0, 0xF0, 0xA0, 0x0C, 0xA0, 0xF0, 0xA0, 0x0F, 0x09,
+    /* 'a' */
+    0x07, 0x07, 0x30, 0xB1, 0x30, 0x08, 0xD0, 0x01, 0xB0, 0xF1, 0xB0, 0x08,
+    0xF0, 0x01, 0xF0, 0x51, 0xF0, 0x08, 0xF0, 0x51, 0xF0, 0x51, 0xF0, 0x08,
+    0xB0, 0xF5, 0x08, 0x30, 0xB0, 0xF3, 0xA0, 0x0F, 0x03,
+    /* 'b' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF7, 0x07, 0x50, 0xF0, 0x50,
+    0x02, 0x50, 0xF0, 0x08, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xB0, 0xF4,
+    0xB0, 0x08, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'c' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x08, 0xB0, 0xF4, 0xB0, 0x08,
+    0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xF0, 0x40, 0x02, 0x40, 0xF0, 0x08,
+    0xB1, 0x02, 0xB1, 0x08, 0x40, 0xD0, 0x02, 0xD0, 0x40, 0x0F, 0x03,
+    /* 'd' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x08, 0xB0, 0xF4, 0xB0, 0x08,
+    0xF0, 0x50, 0x02, 0x50, 0xF0, 0x07, 0x50, 0xF0, 0x50, 0x02, 0x50, 0xF0,
+    0x06, 0xA0, 0xF7, 0x06, 0xA0, 0xF6, 0xA0, 0x0F, 0x03,
+    /* 'e' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x08, 0xB0, 0xF4, 0xB0, 0x08,
+    0xF0, 0x51, 0xF0, 0x51, 0xF0, 0x08, 0xF0, 0x51, 0xF0, 0x01, 0xF0, 0x08,
+    0xB0, 0xF2, 0x01, 0xD0, 0x08, 0x30, 0xB0, 0xF0, 0xA0, 0x0F, 0x06,
+    /* 'f' */
+    0x07, 0x05, 0x50, 0xD0, 0x50, 0x09, 0x30, 0xB0, 0xF5, 0xA0, 0x06, 0xB0,
+    0xF6, 0xA0, 0x06, 0xF0, 0x50, 0x00, 0x50, 0xF0, 0x50, 0x09, 0xF0, 0x02,
+    0xF0, 0x0A, 0xD0, 0x02, 0xD0, 0x0F, 0x07,
+    /* 'g' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x01, 0xD0, 0x05, 0xB0, 0xF4,
+    0xB0, 0x01, 0xF0, 0x05, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x01, 0xF0, 0x05,
+    0xF0, 0x50, 0x02, 0x50, 0xF0, 0x51, 0xF0, 0x05, 0xF8, 0xB0, 0x05, 0xA0,
+    0xF6, 0xB0, 0x30, 0x0F, 0x00,
+    /* 'h' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x07, 0x50, 0xF0,
+    0x50, 0x0D, 0xF0, 0x50, 0x0D, 0xB0, 0xF4, 0xA0, 0x08, 0x30, 0xB0, 0xF3,
+    0xA0, 0x0F, 0x03,
+    /* 'i' */
+    0x07, 0x04, 0xD0, 0x04, 0xD0, 0x08, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x05,
+    0xA1, 0x00, 0xF6, 0x05, 0xA1, 0x00, 0xA0, 0xF5, 0x0D, 0x50, 0xF0, 0x0E,
+    0xD0, 0x0F, 0x03,
+    /* 'j' */
+    0x06, 0x0D, 0xD0, 0x05, 0xD0, 0x07, 0xF0, 0x05, 0xF0, 0x50, 0x05, 0x50,
+    0xF0, 0x02, 0xA1, 0x00, 0xF8, 0xB0, 0x02, 0xA1, 0x00, 0xA0, 0xF6, 0xB0,
+    0x30, 0x0F, 0x00,
+    /* 'k' */
+    0x07, 0x02, 0xA0, 0xF6, 0xA0, 0x06, 0xA0, 0xF6, 0xA0, 0x0A, 0x20, 0xF0,
+    0x20, 0x0B, 0x40, 0xB0, 0xF0, 0xB0, 0x40, 0x09, 0xA0, 0xF0, 0xB0, 0x20,
+    0xB0, 0xF0, 0xA0, 0x08, 0xA0, 0xB0, 0x30, 0x00, 0x30, 0xB0, 0xA0, 0x0F,
+    0x03,
+    /* 'l' */
+    0x07, 0x02, 0xD0, 0x06, 0xD0, 0x06, 0xF0, 0x50, 0x04, 0x50, 0xF0, 0x06,
+    0xF8, 0x06, 0xA0, 0xF7, 0x0D, 0x50, 0xF0, 0x0E, 0xD0, 0x0F, 0x03,
+    /* 'm' */
+    0x08, 0x04, 0xA0, 0xF4, 0xA0, 0x08, 0xF5, 0xA0, 0x08, 0xF0, 0x20, 0x0D,
+    0xF4, 0xD0, 0x09, 0xF0, 0x20, 0x0D, 0xB0, 0xF4, 0xA0, 0x08, 0x30, 0xB0,
+    0xF3, 0xA0, 0x0F, 0x03,
+    /* 'n' */
+    0x07, 0x04, 0xA0, 0xF4, 0xA0, 0x08, 0xF5, 0xA0, 0x08, 0xF0, 0x50, 0x0D,
+    0xF0, 0x50, 0x0D, 0xB0, 0xF4, 0xA0, 0x08, 0x30, 0xB0, 0xF3, 0xA0, 0x0F,
+    0x03,
+    /* 'o' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x08, 0xB0, 0xF4, 0xB0, 0x08,
+    0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08,
+    0xB0, 0xF4, 0xB0, 0x08, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'p' */
+    0x07, 0x04, 0xA0, 0xF7, 0xA0, 0x05, 0xF8, 0xA0, 0x05, 0xF0, 0x50, 0x02,
+    0x50, 0xF0, 0x50, 0x07, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xB0, 0xF4,
+    0xB0, 0x08, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x03,
+    /* 'q' */
+    0x07, 0x04, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x08, 0xB0, 0xF4, 0xB0, 0x08,
+    0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x50,
+    0x07, 0xF8, 0xA0, 0x05, 0xA0, 0xF7, 0xA0, 0x0F, 0x00,
+    /* 'r' */
+    0x07, 0x04, 0xA0, 0xF4, 0xA0, 0x08, 0xA0, 0xF4, 0xA0, 0x09, 0x20, 0xE0,
+    0x50, 0x0B, 0x40, 0xE0, 0x50, 0x0C, 0xB0, 0xF0, 0x0D, 0xA1, 0x0F, 0x08,
+    /* 's' */
+    0x07, 0x04, 0x30, 0xB1, 0x30, 0x01, 0xD0, 0x08, 0xB0, 0xF1, 0xB0, 0x01,
+    0xF0, 0x08, 0xF0, 0x51, 0xF0, 0x01, 0xF0, 0x08, 0xF0, 0x01, 0xF0, 0x51,
+    0xF0, 0x08, 0xF0, 0x01, 0xB0, 0xF1, 0xB0, 0x08, 0xD0, 0x01, 0x30, 0xB1,
+    0x30, 0x0F, 0x03,
+    /* 't' */
+    0x07, 0x03, 0x50, 0xD0, 0x50, 0x0B, 0xA0, 0xF5, 0xB0, 0x30, 0x06, 0xA0,
+    0xF6, 0xB0, 0x07, 0x50, 0xF0, 0x50, 0x02, 0x50, 0xF0, 0x08, 0xF0, 0x04,
+    0xF0, 0x08, 0xD0, 0x04, 0xD0, 0x0F, 0x03,
+    /* 'u' */
+    0x07, 0x04, 0xA0, 0xF3, 0xB0, 0x30, 0x08, 0xA0, 0xF4, 0xB0, 0x0D, 0x50,
+    0xF0, 0x0D, 0x50, 0xF0, 0x08, 0xA0, 0xF5, 0x08, 0xA0, 0xF4, 0xA0, 0x0F,
+    0x03,
+    /* 'v' */
+    0x07, 0x04, 0xA0, 0xF2, 0xB0, 0x30, 0x09, 0xA0, 0xF3, 0xC0, 0x30, 0x0C,
+    0x50, 0xF0, 0xB0, 0x0C, 0x50, 0xF0, 0xB0, 0x08, 0xA0, 0xF3, 0xC0, 0x30,
+    0x08, 0xA0, 0xF2, 0xB0, 0x30, 0x0F, 0x04,
+    /* 'w' */
+    0x08, 0x04, 0xA0, 0xF2, 0xB0, 0x40, 0x09, 0xA0, 0xF4, 0xA0, 0x0C, 0x10,
+    0xA1, 0x09, 0xD0, 0xF1, 0xD0, 0x0E, 0x10, 0xA1, 0x08, 0xA0, 0xF4, 0xA0,
+    0x08, 0xA0, 0xF2, 0xB0, 0x40, 0x0F, 0x04,
+    /* 'x' */
+    0x07, 0x04, 0xA0, 0xB0, 0x30, 0x00, 0x30, 0xB0, 0xA0, 0x08, 0xA0, 0xF0,
+    0xB0, 0x20, 0xB0, 0xF0, 0xA0, 0x09, 0x50, 0xF2, 0x50, 0x0A, 0x50, 0xF2,
+    0x50, 0x09, 0xA0, 0xF0, 0xB0, 0x20, 0xB0, 0xF0, 0xA0, 0x08, 0xA0, 0xB0,
+    0x30, 0x00, 0x30, 0xB0, 0xA0, 0x0F, 0x03,
+    /* 'y' */
+    0x08, 0x0D, 0xD0, 0x05, 0xA0, 0xF3, 0xB0, 0x30, 0x01, 0xF0, 0x05, 0xA0,
+    0xF4, 0xB0, 0x00, 0x40, 0xF0, 0x0A, 0x50, 0xF0, 0x20, 0xB1, 0x0A, 0x50,
+    0xF1, 0xC0, 0x30, 0x05, 0xA0, 0xF5, 0xB0, 0x30, 0x06, 0xA0, 0xF3, 0xB0,
+    0x40, 0x0F, 0x03,
+    /* 'z' */
+    0x07, 0x04, 0xD0, 0x02, 0x30, 0xB0, 0xA0, 0x08, 0xF0, 0x01, 0x30, 0xC0,
+    0xF1, 0x08, 0xF0, 0x00, 0x30, 0xC0, 0xB0, 0x20, 0xF0, 0x08, 0xF0, 0x20,
+    0xB0, 0xC0, 0x30, 0x00, 0xF0, 0x08, 0xF1, 0xC0, 0x30, 0x01, 0xF0, 0x08,
+    0xA0, 0xB0, 0x30, 0x02, 0xD0, 0x0F, 0x03,
+    /* '{' */
+    0x06, 0x06, 0x40, 0xD0, 0x40, 0x0B, 0x40, 0xC0, 0xF0, 0xC0, 0x40, 0x07,
+    0x30, 0xB0, 0xF1, 0xB0, 0x20, 0xB0, 0xF1, 0xB0, 0x30, 0x04, 0xB0, 0xF1,
+    0xB0, 0x30, 0x00, 0x30, 0xB0, 0xF1, 0xB0, 0x04, 0xD0, 0x50, 0x06, 0x50,
+    0xD0, 0x0F, 0x01,
+    /* '|' */
+    0x03, 0x02, 0xA0, 0xF9, 0xA0, 0x03, 0xA0, 0xF9, 0xA0, 0x0F, 0x00,
+    /* '}' */
+    0x06, 0x02, 0xD0, 0x50, 0x06, 0x50, 0xD0, 0x04, 0xB0, 0xF1, 0xB0, 0x30,
+    0x00, 0x30, 0xB0, 0xF1, 0xB0, 0x04, 0x30, 0xB0, 0xF1, 0xB0, 0x20, 0xB0,
+    0xF1, 0xB0, 0x30, 0x07, 0x40, 0xC0, 0xF0, 0xC0, 0x40, 0x0B, 0x40, 0xD0,
+    0x40, 0x0F, 0x05,
+    /* '~' */
+    0x09, 0x02, 0x30, 0xB0, 0xD0, 0x0C, 0xB1, 0x40, 0x0C, 0xF0, 0x20, 0x0D,
+    0xB1, 0x30, 0x0C, 0x30, 0xB1, 0x0D, 0x20, 0xF0, 0x0C, 0x40, 0xB1, 0x0C,
+    0xD0, 0xB0, 0x30, 0x0F, 0x09,
+};
@@ -0,0 +1,20 @@
+/* Generated by tools/fontc.py from fonts.txt - do not edit */
+
+#ifndef __GEN_FONTS_H__
+#define __GEN_FONTS_H__
+
+/* -- INCLUDES -- */
+#include "bspDataTypes.h"
+
+/* -- DEFINES and ENUMS -- */
+/* Font numbers for LCD_SetFont */
+#define FONT_SMALL              0   /* 8 pixels high */
+#define FONT_SYSTEM             1   /* 16 pixels high */
+#define FONT_SMOOTH             2   /* 16 pixels high, anti-aliased */
+
+#define FONT_BLOB_SIZE          5645
+
+/* -- GLOBAL VARIABLES -- */
+extern const BYTE gabyFontBlob[FONT_BLOB_SIZE];
+
+#endif /* __GEN_FONTS_H__ */
@@ -0,0 +1,467 @@
+/* Generated by tools/spritec.py from sprites.txt - do not edit */
+
+/* -- INCLUDES -- */
+#include "GLCD.h"
+#include "gen_sprites.h"
+
+/* -- STATIC AND GLOBAL VARIABLES -- */
+/* Shared palette; index 0 is transparent in sprites and the background tile */
+static const WORD scawSpritePalette[16] =
+{
+    0x0000, RED, YELLOW, BLUE, MAGENTA
+};
+
+/* Solid tiles, one per palette color */
+static const BYTE scabySpriteTiles[5 * TILE_BYTES] =
+{
+    /* background */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* RED */
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    /* YELLOW */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    /* BLUE */
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    /* MAGENTA */
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+};
+
+const TILE_SET_T gsSpriteTileSet =
+{
+    scabySpriteTiles, scawSpritePalette
+};
+
+static const SPRITE_RUN_T scasUFORuns[] =
+{
+    {  16,   0,   8,  16 },
+    {   8,  16,  24,   8 },
+    {   0,  24,  40,  56 },
+    {   8,  80,  24,   8 },
+    {  16,  88,   8,  16 },
+};
+
+static const BYTE scabyUFOPixels[] =
+{
+    /* 8x16 at 16,0 */
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22,
+    /* 24x8 at 8,16 */
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    /* 40x56 at 0,24 */
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33,
+    /* 24x8 at 8,80 */
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33,
+    /* 8x16 at 16,88 */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11,
+};
+
+const SPRITE_T gsUFOSprite =
+{
+    40, 104,
+    5, scasUFORuns,
+    scabyUFOPixels, scawSpritePalette
+};
+
+/* Landscape orientation, row by row, 0 is transparent */
+const BYTE gabyUFOCells[UFO_CELL_ROWS * UFO_CELL_COLUMNS] =
+{
+    0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+    0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+};
+
+static const SPRITE_RUN_T scasGrenadeRuns[] =
+{
+    {   0,   0,  24,   8 },
+    {   0,   8,  40,   8 },
+    {   0,  16,  24,   8 },
+};
+
+static const BYTE scabyGrenadePixels[] =
+{
+    /* 24x8 at 0,0 */
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    /* 40x8 at 0,8 */
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44,
+    /* 24x8 at 0,16 */
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+};
+
+const SPRITE_T gsGrenadeSprite =
+{
+    40, 24,
+    3, scasGrenadeRuns,
+    scabyGrenadePixels, scawSpritePalette
+};
+
+/* Landscape orientation, row by row, 0 is transparent */
+const BYTE gabyGrenadeCells[GRENADE_CELL_ROWS * GRENADE_CELL_COLUMNS] =
+{
+    4, 4, 4,
+    4, 4, 4,
+    4, 4, 4,
+    0, 4, 0,
+    0, 4, 0,
+};
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DrawUFOSprite(WORD wX, WORD wY)
+
+    @Description: Compiled UFO sprite: draws its opaque windows with no
+                  clipping, so the sprite must lie entirely on the display.
+
+    @Parameters: WORD wX - Top-left row coordinate of the bounding box
+                 WORD wY - Top-left line coordinate of the bounding box
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DrawUFOSprite(WORD wX, WORD wY)
+{
+    LCD_BeginWrite(wX + 16, wY + 0, 8, 16);
+    LCD_WriteRepeat(RED, 64);
+    LCD_WriteRepeat(YELLOW, 64);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 8, wY + 16, 24, 8);
+    LCD_WriteRepeat(BLUE, 8);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 8);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 0, wY + 24, 40, 56);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 32);
+    LCD_WriteRepeat(YELLOW, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 8, wY + 80, 24, 8);
+    LCD_WriteRepeat(BLUE, 8);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 16);
+    LCD_WriteRepeat(RED, 8);
+    LCD_WriteRepeat(BLUE, 8);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 16, wY + 88, 8, 16);
+    LCD_WriteRepeat(YELLOW, 64);
+    LCD_WriteRepeat(RED, 64);
+    LCD_EndWrite();
+}
+
+
+/*----------------------------------------------------------------------------
+
+    @Prototype: void DrawGrenadeSprite(WORD wX, WORD wY)
+
+    @Description: Compiled Grenade sprite: draws its opaque windows with no
+                  clipping, so the sprite must lie entirely on the display.
+
+    @Parameters: WORD wX - Top-left row coordinate of the bounding box
+                 WORD wY - Top-left line coordinate of the bounding box
+
+    @Returns: void
+
+ *----------------------------------------------------------------------------*/
+void DrawGrenadeSprite(WORD wX, WORD wY)
+{
+    LCD_BeginWrite(wX + 0, wY + 0, 24, 8);
+    LCD_WriteRepeat(MAGENTA, 192);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 0, wY + 8, 40, 8);
+    LCD_WriteRepeat(MAGENTA, 320);
+    LCD_EndWrite();
+
+    LCD_BeginWrite(wX + 0, wY + 16, 24, 8);
+    LCD_WriteRepeat(MAGENTA, 192);
+    LCD_EndWrite();
+}
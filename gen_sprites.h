@@ -0,0 +1,32 @@
+/* Generated by tools/spritec.py from sprites.txt - do not edit */
+
+#ifndef __GEN_SPRITES_H__
+#define __GEN_SPRITES_H__
+
+/* -- INCLUDES -- */
+#include "bspHardwareAbstractionLayer.h"
+#include "bspTileMap.h"
+
+/* -- DEFINES and ENUMS -- */
+/* Sprite bounding boxes in display orientation, cell maps in landscape */
+#define UFO_SPRITE_WIDTH        40
+#define UFO_SPRITE_HEIGHT       104
+#define UFO_CELL_COLUMNS        13
+#define UFO_CELL_ROWS           5
+#define GRENADE_SPRITE_WIDTH    40
+#define GRENADE_SPRITE_HEIGHT   24
+#define GRENADE_CELL_COLUMNS    3
+#define GRENADE_CELL_ROWS       5
+
+/* -- GLOBAL VARIABLES -- */
+extern const TILE_SET_T gsSpriteTileSet;
+extern const SPRITE_T gsUFOSprite;
+extern const BYTE gabyUFOCells[];
+extern const SPRITE_T gsGrenadeSprite;
+extern const BYTE gabyGrenadeCells[];
+
+/* -- EXTERNAL FUNCTIONS -- */
+extern void DrawUFOSprite(WORD wX, WORD wY);
+extern void DrawGrenadeSprite(WORD wX, WORD wY);
+
+#endif /* __GEN_SPRITES_H__ */
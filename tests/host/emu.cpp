@@ -0,0 +1,232 @@
+// Bus and controller model for the host tests, see emu.h.
+#include "LPC17xx.h"
+#include "emu.h"
+#include <stdio.h>
+
+LPC_GPIO_TypeDef mock_gpio0, mock_gpio1, mock_gpio2;
+LPC_SC_TypeDef mock_sc;
+LPC_TIM_TypeDef mock_tim0;
+LPC_PINCON_TypeDef mock_pincon;
+uint32_t SystemCoreClock = 100000000;
+
+EmuCounters emu_cnt;
+uint16_t emu_gram[320][240];
+uint16_t emu_reg[256];
+int emu_ctrl;
+uint16_t emu_device_code;
+int emu_bgr_model;
+uint64_t emu_ns;
+int emu_failures;
+int emu_bus_off;
+
+// Virtual SysTick: fires the firmware's handler, when one is linked in, each
+// time the bus clock crosses a period
+void SysTick_Handler(void) __attribute__((weak));
+static uint64_t tick_ns, next_tick;
+
+uint32_t SysTick_Config(uint32_t ticks)
+{
+  tick_ns = (uint64_t)ticks * 1000000000u / SystemCoreClock;
+  next_tick = emu_ns + tick_ns;
+  return 0;
+}
+void SystemInit(void) {}
+
+static void run_ticks(void)
+{
+  while (tick_ns && emu_ns >= next_tick) {
+    next_tick += tick_ns;
+    if (SysTick_Handler) SysTick_Handler();
+  }
+}
+
+void emu_idle(void)
+{
+  if (!tick_ns) return;
+  emu_ns = next_tick;
+  run_ticks();
+}
+
+// bspLPC1768.c is built through hal.cpp with its LCD_PollInitialization
+// calls renamed to this, so the wait loop lets virtual time pass
+uint8_t LCD_PollInitialization(uint32_t Now);
+uint8_t emu_PollInitialization(uint32_t Now)
+{
+  uint8_t done = LCD_PollInitialization(Now);
+  if (!done) emu_idle();
+  return done;
+}
+
+static uint32_t out0 = 0xFFFFFFFF, out2;
+static uint8_t latch;
+static uint16_t index_reg;
+static int acx, acy;
+static int read_dummy;
+static uint16_t read_val;
+static int in_store;
+
+#define P_EN  (1u << 19)
+#define P_LE  (1u << 20)
+#define P_DIR (1u << 21)
+#define P_CS  (1u << 22)
+#define P_RS  (1u << 23)
+#define P_WR  (1u << 24)
+#define P_RD  (1u << 25)
+
+static int ssd() { return emu_ctrl == EMU_SSD1289; }
+static int win_xs() { return ssd() ? (emu_reg[0x44] & 0xFF) : emu_reg[0x50]; }
+static int win_xe() { return ssd() ? (emu_reg[0x44] >> 8) : emu_reg[0x51]; }
+static int win_ys() { return ssd() ? emu_reg[0x45] : emu_reg[0x52]; }
+static int win_ye() { return ssd() ? emu_reg[0x46] : emu_reg[0x53]; }
+static uint16_t entry() { return ssd() ? emu_reg[0x11] : emu_reg[0x03]; }
+
+// Address counter step after a GRAM access: ID0/ID1 pick the direction,
+// AM the axis, and the window edges wrap it
+static void advance(void)
+{
+  uint16_t e = entry();
+  int id0 = (e >> 4) & 1, id1 = (e >> 5) & 1, am = (e >> 3) & 1;
+  int xs = win_xs(), xe = win_xe(), ys = win_ys(), ye = win_ye();
+  if (!am) {
+    acx += id0 ? 1 : -1;
+    if (acx > xe || acx < xs) {
+      acx = id0 ? xs : xe;
+      acy += id1 ? 1 : -1;
+      if (acy > ye || acy < ys) acy = id1 ? ys : ye;
+    }
+  } else {
+    acy += id1 ? 1 : -1;
+    if (acy > ye || acy < ys) {
+      acy = id1 ? ys : ye;
+      acx += id0 ? 1 : -1;
+      if (acx > xe || acx < xs) acx = id0 ? xs : xe;
+    }
+  }
+}
+
+static uint16_t swap_rb(uint16_t c) { return (uint16_t)(((c & 0x1F) << 11) | (c & 0x7E0) | (c >> 11)); }
+
+static void write_data(uint16_t d)
+{
+  if (emu_bgr_model && !ssd() && index_reg == 0x22 && (emu_reg[0x03] & 0x1000)) d = swap_rb(d);
+  emu_cnt.data_writes++;
+  if (index_reg == 0x22) {
+    emu_cnt.gram_writes++;
+    if (acx >= 0 && acx < 240 && acy >= 0 && acy < 320) emu_gram[acy][acx] = d;
+    advance();
+    return;
+  }
+  emu_cnt.reg_writes[index_reg & 0xFF]++;
+  emu_reg[index_reg & 0xFF] = d;
+  if (ssd()) {
+    if (index_reg == 0x4E) acx = d & 0xFF;
+    if (index_reg == 0x4F) acy = d & 0x1FF;
+  } else {
+    if (index_reg == 0x20) acx = d & 0xFF;
+    if (index_reg == 0x21) acy = d & 0x1FF;
+  }
+}
+
+static uint16_t do_read(void)
+{
+  emu_cnt.data_reads++;
+  if (index_reg == 0x00) return emu_device_code;
+  if (index_reg == 0x22) {
+    if (read_dummy) { read_dummy = 0; return 0xDEAD; }
+    uint16_t v = (acx >= 0 && acx < 240 && acy >= 0 && acy < 320) ? emu_gram[acy][acx] : 0;
+    advance();
+    return v;
+  }
+  return emu_reg[index_reg & 0xFF];
+}
+
+// The controller latches an index or data word on the WR rising edge and
+// drives the bus from the RD falling edge, both only while CS is low
+static void pins_changed(uint32_t old0, uint32_t new0)
+{
+  if (new0 & P_LE) latch = out2 & 0xFF;
+  if (!(new0 & P_CS)) {
+    if (!(old0 & P_WR) && (new0 & P_WR)) {
+      uint16_t bus = (uint16_t)(((out2 & 0xFF) << 8) | latch);
+      if (!(new0 & P_RS)) { emu_cnt.index_writes++; index_reg = bus; read_dummy = 1; }
+      else write_data(bus);
+    }
+    if ((old0 & P_RD) && !(new0 & P_RD)) read_val = do_read();
+  }
+}
+
+void mock_store(const void *reg, uint32_t, uint32_t nv)
+{
+  if (emu_bus_off) { emu_cnt.gpio0_stores++; return; }
+  if (in_store) return;
+  in_store = 1;
+  const LPC_GPIO_TypeDef *g0 = &mock_gpio0, *g2 = &mock_gpio2;
+  if ((const char *)reg >= (const char *)g0 && (const char *)reg < (const char *)(g0 + 1)) {
+    emu_cnt.gpio0_stores++;
+    emu_ns += EMU_STORE_NS;
+    uint32_t o = out0;
+    if (reg == &g0->FIOSET) out0 |= nv & ~g0->FIOMASK.v;
+    else if (reg == &g0->FIOCLR) out0 &= ~(nv & ~g0->FIOMASK.v);
+    else if (reg == &g0->FIOPIN) out0 = (out0 & g0->FIOMASK.v) | (nv & ~g0->FIOMASK.v);
+    else if (reg == &g0->FIOSET2) out0 |= (nv & 0xFF) << 16;
+    else if (reg == &g0->FIOCLR2) out0 &= ~((nv & 0xFF) << 16);
+    else if (reg == &g0->FIOSET3) out0 |= (nv & 0xFF) << 24;
+    else if (reg == &g0->FIOCLR3) out0 &= ~((nv & 0xFF) << 24);
+    pins_changed(o, out0);
+  } else if ((const char *)reg >= (const char *)g2 && (const char *)reg < (const char *)(g2 + 1)) {
+    emu_cnt.gpio2_stores++;
+    emu_ns += EMU_STORE_NS;
+    if (reg == &g2->FIOPIN) out2 = (out2 & g2->FIOMASK.v) | (nv & ~g2->FIOMASK.v);
+    else if (reg == &g2->FIOPIN0) out2 = (out2 & ~0xFFu) | (nv & 0xFF);
+    else if (reg == &g2->FIOSET) out2 |= nv;
+    else if (reg == &g2->FIOCLR) out2 &= ~nv;
+    if (out0 & P_LE) latch = out2 & 0xFF;
+  }
+  in_store = 0;
+  run_ticks();
+}
+
+uint32_t mock_load(const void *reg, uint32_t v)
+{
+  if (reg == &mock_gpio2.FIOPIN0 || reg == &mock_gpio2.FIOPIN) {
+    emu_cnt.gpio_loads++;
+    if (!(out0 & P_RD)) return (out0 & P_EN) ? (read_val & 0xFF) : (read_val >> 8);
+  }
+  if (reg == &mock_gpio0.FIOPIN) return out0;
+  if (reg == &mock_gpio1.FIOPIN) return 0xFFFFFFFF;   // joystick released
+  return v;
+}
+
+void emu_reset(int ctrl)
+{
+  emu_ctrl = ctrl;
+  emu_device_code = ssd() ? 0x8989 : 0x9325;
+  // Cleared behind MReg's back, so the reset is not counted as bus stores
+  memset((void *)&mock_gpio0, 0, sizeof mock_gpio0);
+  memset((void *)&mock_gpio2, 0, sizeof mock_gpio2);
+  memset(emu_gram, 0x55, sizeof emu_gram);
+  memset(emu_reg, 0, sizeof emu_reg);
+  out0 = 0xFFFFFFFF; out2 = 0; latch = 0; index_reg = 0; acx = acy = 0;
+  if (ssd()) { emu_reg[0x11] = 0x6830; emu_reg[0x44] = 0xEF00; emu_reg[0x45] = 0; emu_reg[0x46] = 0x13F; }
+  else { emu_reg[0x03] = 0x0030; emu_reg[0x51] = 0xEF; emu_reg[0x53] = 0x13F; }
+  emu_ns = 0; tick_ns = 0;
+  emu_clear_counters();
+}
+
+void emu_clear_counters(void) { memset(&emu_cnt, 0, sizeof emu_cnt); }
+
+uint64_t emu_stores(void) { return emu_cnt.gpio0_stores + emu_cnt.gpio2_stores; }
+
+void emu_print(const char *tag)
+{
+  printf("%-30s stores %9llu  index %7llu  data %8llu  gram %8llu  reads %llu\n", tag,
+         (unsigned long long)emu_stores(), (unsigned long long)emu_cnt.index_writes,
+         (unsigned long long)emu_cnt.data_writes, (unsigned long long)emu_cnt.gram_writes,
+         (unsigned long long)emu_cnt.data_reads);
+}
+
+int emu_result(void)
+{
+  printf(emu_failures ? "%d check(s) FAILED\n" : "ok\n", emu_failures);
+  return emu_failures != 0;
+}
@@ -0,0 +1,42 @@
+// Model of the LandTiger 8080 bus and of the SSD1289 / ILI9325 controllers
+// behind the mocked GPIO registers: registers, a 240x320 GRAM with the
+// window, entry-mode and address-counter rules, and reads with the dummy
+// word. Every GPIO store also advances a virtual clock that drives SysTick.
+#ifndef EMU_H
+#define EMU_H
+#include <stdint.h>
+
+enum { EMU_SSD1289, EMU_ILI9325 };
+
+struct EmuCounters {
+  uint64_t gpio0_stores, gpio2_stores, gpio_loads;
+  uint64_t index_writes, data_writes, gram_writes, data_reads;
+  uint32_t reg_writes[256];   // data writes per register index, GRAM excluded
+};
+
+// Virtual bus time charged per GPIO store; busy-wait loops are free
+#define EMU_STORE_NS 20
+
+extern EmuCounters emu_cnt;
+extern uint16_t emu_gram[320][240];   // [y][x] panel coordinates
+extern uint16_t emu_reg[256];
+extern int emu_ctrl;
+extern uint16_t emu_device_code;      // R00 read, set by emu_reset
+extern int emu_bgr_model;             // ILI: R03 BGR swaps red and blue
+extern uint64_t emu_ns;               // virtual time since emu_reset
+// Count stores without modelling them, to time the code that issues them;
+// GRAM and pin state are not updated meanwhile
+extern int emu_bus_off;
+
+void emu_reset(int ctrl);
+void emu_clear_counters(void);
+uint64_t emu_stores(void);
+void emu_print(const char *tag);
+void emu_idle(void);                  // skip ahead to the next SysTick
+
+// Small shared helpers for the tests
+#define CHECK(cond, ...) \
+  do { if (!(cond)) { printf("FAIL %s:%d: ", __FILE__, __LINE__); printf(__VA_ARGS__); printf("\n"); emu_failures++; } } while (0)
+extern int emu_failures;
+int emu_result(void);                 // exit code: 1 after any failed CHECK
+#endif
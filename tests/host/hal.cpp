@@ -0,0 +1,4 @@
+// bspLPC1768.c for the host: its display-init wait loop polls through
+// emu_PollInitialization, which lets the virtual clock run while waiting.
+#define LCD_PollInitialization emu_PollInitialization
+#include "bspLPC1768.c"
@@ -0,0 +1,228 @@
+// Baseline drawing code, see legacy.h. Store for store the same GPIO
+// sequence as the vendor driver at DISP_ORIENTATION 0.
+#include "LPC17xx.h"
+#include "legacy.h"
+#include "emu.h"
+#include "AsciiLib.h"
+
+#define PIN_EN  (1 << 19)
+#define PIN_LE  (1 << 20)
+#define PIN_DIR (1 << 21)
+#define PIN_CS  (1 << 22)
+#define PIN_RS  (1 << 23)
+#define PIN_WR  (1 << 24)
+#define PIN_RD  (1 << 25)
+#define PIN(p, x) ((x) ? (LPC_GPIO0->FIOSET = (p)) : (LPC_GPIO0->FIOCLR = (p)))
+
+#define MAX_X 240
+#define MAX_Y 320
+
+static void wait_delay(volatile int count)
+{
+  while (count--);
+}
+
+static void Send(uint16_t byte)
+{
+  LPC_GPIO2->FIODIR |= 0xFF;
+  PIN(PIN_DIR, 1);
+  PIN(PIN_EN, 0);
+  LPC_GPIO2->FIOPIN = byte;
+  PIN(PIN_LE, 1);
+  PIN(PIN_LE, 0);
+  LPC_GPIO2->FIOPIN = byte >> 8;
+}
+
+static void WriteIndex(uint16_t index)
+{
+  PIN(PIN_CS, 0);
+  PIN(PIN_RS, 0);
+  PIN(PIN_RD, 1);
+  Send(index);
+  wait_delay(25);
+  PIN(PIN_WR, 0);
+  wait_delay(1);
+  PIN(PIN_WR, 1);
+  PIN(PIN_CS, 1);
+}
+
+static void WriteData(uint16_t data)
+{
+  PIN(PIN_CS, 0);
+  PIN(PIN_RS, 1);
+  Send(data);
+  PIN(PIN_WR, 0);
+  wait_delay(1);
+  PIN(PIN_WR, 1);
+  PIN(PIN_CS, 1);
+}
+
+static void WriteReg(uint16_t reg, uint16_t value)
+{
+  WriteIndex(reg);
+  WriteData(value);
+}
+
+static void SetCursor(uint16_t Xpos, uint16_t Ypos)
+{
+  if (emu_ctrl == EMU_SSD1289) {
+    WriteReg(0x004e, Xpos);
+    WriteReg(0x004f, Ypos);
+  } else {
+    WriteReg(0x0020, Xpos);
+    WriteReg(0x0021, Ypos);
+  }
+}
+
+void Legacy_WriteReg(uint16_t reg, uint16_t value)
+{
+  WriteReg(reg, value);
+}
+
+// The vendor loop was sized for 1 ms per count
+void Legacy_DelayMs(uint16_t ms)
+{
+  emu_ns += (uint64_t)ms * 1000000u;
+}
+
+void Legacy_SetPoint(uint16_t Xpos, uint16_t Ypos, uint16_t point)
+{
+  if (Xpos >= MAX_X || Ypos >= MAX_Y) return;
+  SetCursor(Xpos, Ypos);
+  WriteReg(0x0022, point);
+}
+
+void Legacy_Clear(uint16_t Color)
+{
+  uint32_t index;
+
+  SetCursor(0, 0);
+  WriteIndex(0x0022);
+  for (index = 0; index < MAX_X * MAX_Y; index++) WriteData(Color);
+}
+
+// Sorts x and y independently, so it only draws lines of positive slope
+// correctly; kept as it was, it only serves as the cost baseline
+void Legacy_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  short dx, dy, temp;
+
+  if (x0 > x1) { temp = x1; x1 = x0; x0 = temp; }
+  if (y0 > y1) { temp = y1; y1 = y0; y0 = temp; }
+  dx = x1 - x0;
+  dy = y1 - y0;
+  if (dx == 0) {
+    do { Legacy_SetPoint(x0, y0, color); y0++; } while (y1 >= y0);
+    return;
+  }
+  if (dy == 0) {
+    do { Legacy_SetPoint(x0, y0, color); x0++; } while (x1 >= x0);
+    return;
+  }
+  if (dx > dy) {
+    temp = 2 * dy - dx;
+    while (x0 != x1) {
+      Legacy_SetPoint(x0, y0, color);
+      x0++;
+      if (temp > 0) { y0++; temp += 2 * dy - 2 * dx; }
+      else temp += 2 * dy;
+    }
+    Legacy_SetPoint(x0, y0, color);
+  } else {
+    temp = 2 * dx - dy;
+    while (y0 != y1) {
+      Legacy_SetPoint(x0, y0, color);
+      y0++;
+      if (temp > 0) { x0++; temp += 2 * dy - 2 * dx; }
+      else temp += 2 * dy;
+    }
+    Legacy_SetPoint(x0, y0, color);
+  }
+}
+
+void Legacy_PutChar(uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor)
+{
+  uint16_t i, j;
+  uint8_t buffer[16], tmp_char;
+
+  GetASCIICode(buffer, ASCI);
+  for (i = 0; i < 16; i++) {
+    tmp_char = buffer[i];
+    for (j = 0; j < 8; j++) {
+      if ((tmp_char >> (7 - j)) & 0x01)
+        Legacy_SetPoint(Xpos + j, Ypos + i, charColor);
+      else
+        Legacy_SetPoint(Xpos + j, Ypos + i, bkColor);
+    }
+  }
+}
+
+#define RED     0xF800
+#define YELLOW  0xFFE0
+#define BLUE    0x001F
+#define MAGENTA 0xF81F
+
+void Legacy_DisplayUFO(uint16_t wXPos, uint16_t wYPos)
+{
+  uint16_t wX, wY;
+
+  for (wX = (wXPos - (6 * 8)); wX < (wXPos + (7 * 8)); wX++) {
+    for (wY = (wYPos - (2 * 8)); wY < (wYPos + (3 * 8)); wY++) {
+      if ((((wX >= (wXPos - (6 * 8))) && (wX < (wXPos - (5 * 8)))) ||
+           ((wX >= (wXPos - (4 * 8))) && (wX < (wXPos - (3 * 8)))) ||
+           ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
+           ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
+           ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
+           ((wX >= (wXPos + (4 * 8))) && (wX < (wXPos + (5 * 8)))) ||
+           ((wX >= (wXPos + (6 * 8))) && (wX < (wXPos + (7 * 8))))) &&
+          ((wY >= (wYPos + (0 * 8))) && (wY < (wYPos + (1 * 8)))))
+        Legacy_SetPoint(wY, wX, RED);
+      if ((((wX >= (wXPos - (5 * 8))) && (wX < (wXPos - (4 * 8)))) ||
+           ((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
+           ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
+           ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
+           ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8)))) ||
+           ((wX >= (wXPos + (5 * 8))) && (wX < (wXPos + (6 * 8))))) &&
+          ((wY >= (wYPos + (0 * 8))) && (wY < (wYPos + (1 * 8)))))
+        Legacy_SetPoint(wY, wX, YELLOW);
+      if ((((wX >= (wXPos - (4 * 8))) && (wX < (wXPos - (3 * 8)))) ||
+           ((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
+           ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
+           ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
+           ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
+           ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
+           ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
+           ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8)))) ||
+           ((wX >= (wXPos + (4 * 8))) && (wX < (wXPos + (5 * 8))))) &&
+          (((wY >= (wYPos + (1 * 8))) && (wY < (wYPos + (2 * 8)))) ||
+           ((wY >= (wYPos - (1 * 8))) && (wY < (wYPos - (0 * 8))))))
+        Legacy_SetPoint(wY, wX, BLUE);
+      if ((((wX >= (wXPos - (3 * 8))) && (wX < (wXPos - (2 * 8)))) ||
+           ((wX >= (wXPos - (2 * 8))) && (wX < (wXPos - (1 * 8)))) ||
+           ((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
+           ((wX >= (wXPos + (0 * 8))) && (wX < (wXPos + (1 * 8)))) ||
+           ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8)))) ||
+           ((wX >= (wXPos + (2 * 8))) && (wX < (wXPos + (3 * 8)))) ||
+           ((wX >= (wXPos + (3 * 8))) && (wX < (wXPos + (4 * 8))))) &&
+          (((wY >= (wYPos + (2 * 8))) && (wY < (wYPos + (3 * 8)))) ||
+           ((wY >= (wYPos - (2 * 8))) && (wY < (wYPos - (1 * 8))))))
+        Legacy_SetPoint(wY, wX, BLUE);
+    }
+  }
+}
+
+void Legacy_DisplayGrenade(uint16_t wXPos, uint16_t wYPos)
+{
+  uint16_t wX, wY;
+
+  for (wX = (wXPos - (1 * 8)); wX < (wXPos + (2 * 8)); wX++) {
+    for (wY = (wYPos - (1 * 8)); wY < (wYPos + (4 * 8)); wY++) {
+      if ((((wX >= (wXPos - (1 * 8))) && (wX < (wXPos - (0 * 8)))) ||
+           ((wX >= (wXPos + (1 * 8))) && (wX < (wXPos + (2 * 8))))) &&
+          (((wY >= (wYPos + (2 * 8))) && (wY < (wYPos + (3 * 8)))) ||
+           ((wY >= (wYPos + (3 * 8))) && (wY < (wYPos + (4 * 8))))))
+        continue;
+      Legacy_SetPoint(wY, wX, MAGENTA);
+    }
+  }
+}
@@ -0,0 +1,22 @@
+// The vendor drawing code the backlog replaced, reproduced from the
+// baseline GLCD.c and apUFO.c for before/after measurements: one bus
+// transaction per pixel, cursor set before every point. Run it on a
+// freshly initialised emulator, it bypasses the driver's cursor model.
+#ifndef LEGACY_H
+#define LEGACY_H
+#include <stdint.h>
+
+void Legacy_SetPoint(uint16_t Xpos, uint16_t Ypos, uint16_t point);
+void Legacy_Clear(uint16_t Color);
+void Legacy_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+void Legacy_PutChar(uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor);
+
+// The blocking init's pieces: its register write, and delay_ms, whose
+// busy-wait makes no stores and is charged to the virtual clock instead
+void Legacy_WriteReg(uint16_t reg, uint16_t value);
+void Legacy_DelayMs(uint16_t ms);
+
+// apUFO.c nested loops, landscape game coordinates
+void Legacy_DisplayUFO(uint16_t wXPos, uint16_t wYPos);
+void Legacy_DisplayGrenade(uint16_t wXPos, uint16_t wYPos);
+#endif
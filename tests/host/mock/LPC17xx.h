@@ -0,0 +1,48 @@
+// Host stand-in for the parts of LPC17xx.h the demo uses. The firmware is
+// compiled as C++ against it so that every GPIO register access goes
+// through MReg and reaches the bus model in emu.cpp, which counts it.
+#ifndef MOCK_LPC17XX_H
+#define MOCK_LPC17XX_H
+#include <stdint.h>
+#include <string.h>
+
+void     mock_store(const void *reg, uint32_t oldv, uint32_t newv);
+uint32_t mock_load(const void *reg, uint32_t v);
+
+struct MReg {
+  uint32_t v;
+  operator uint32_t() const { return mock_load(this, v); }
+  MReg &operator=(uint32_t x) { uint32_t o = v; v = x; mock_store(this, o, x); return *this; }
+  MReg &operator=(const MReg &r) { return *this = (uint32_t)r; }
+  // Masks built from 1UL shifts are 32 bits on the target but 64 on the host
+  MReg &operator|=(unsigned long x) { return *this = ((uint32_t)*this | (uint32_t)x); }
+  MReg &operator&=(unsigned long x) { return *this = ((uint32_t)*this & (uint32_t)x); }
+};
+
+typedef struct {
+  MReg FIODIR, FIOMASK, FIOPIN, FIOSET, FIOCLR;
+  MReg FIOPIN0, FIODIR0, FIOMASK0, FIOSET0, FIOCLR0;
+  MReg FIOPIN2, FIOSET2, FIOCLR2, FIOSET3, FIOCLR3;
+} LPC_GPIO_TypeDef;
+
+extern LPC_GPIO_TypeDef mock_gpio0, mock_gpio1, mock_gpio2;
+#define LPC_GPIO0 (&mock_gpio0)
+#define LPC_GPIO1 (&mock_gpio1)
+#define LPC_GPIO2 (&mock_gpio2)
+
+typedef struct { volatile uint32_t EXTINT, PCONP, PCLKSEL0, EXTMODE, EXTPOLAR, CCLKCFG; } LPC_SC_TypeDef;
+typedef struct { volatile uint32_t IR, MR0, MCR, TCR, TC; } LPC_TIM_TypeDef;
+typedef struct { volatile uint32_t PINSEL4; } LPC_PINCON_TypeDef;
+extern LPC_SC_TypeDef mock_sc;
+extern LPC_TIM_TypeDef mock_tim0;
+extern LPC_PINCON_TypeDef mock_pincon;
+#define LPC_SC (&mock_sc)
+#define LPC_TIM0 (&mock_tim0)
+#define LPC_PINCON (&mock_pincon)
+
+typedef enum { TIMER0_IRQn = 1, EINT0_IRQn = 18 } IRQn_Type;
+static inline void NVIC_EnableIRQ(IRQn_Type) {}
+uint32_t SysTick_Config(uint32_t ticks);
+void SystemInit(void);
+extern uint32_t SystemCoreClock;
+#endif
@@ -0,0 +1,115 @@
+// LCD_BlitRGB565 and LCD_BlitPal4 against a reference copy at random,
+// partly off-screen positions, then the UFO drawn by the old nested loops
+// against the same image blitted in both formats: bus cost and host time
+// (which includes the bus model, so only the ratio means anything).
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static uint16_t ref[320][240], before[320][240];
+
+// UFO bounding box in display coordinates for Legacy_DisplayUFO(160, 24)
+#define UFO_X 8
+#define UFO_Y 112
+#define UFO_W 40
+#define UFO_H 104
+
+static uint16_t ufo565[UFO_W * UFO_H];
+static uint8_t ufo4[UFO_W / 2 * UFO_H];
+static const uint16_t palette[16] = { Black, Red, Yellow, Blue };
+
+template <class F> static double HostMicros(F f)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < 2000; i++) f();
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / 2000;
+}
+
+static void Random(void)
+{
+  static uint16_t px[64 * 64];
+  static uint8_t p4[32 * 64];
+  uint16_t pal[16];
+
+  LCD_Clear(Black);
+  memset(ref, 0, sizeof ref);
+  srand(7);
+  for (int t = 0; t < 3000; t++) {
+    int w = 1 + rand() % 63, h = 1 + rand() % 63;
+    int x = rand() % (240 + 2 * w) - w, y = rand() % (320 + 2 * h) - h;
+    int four = rand() & 1, stride = (w + 1) / 2;
+    for (int i = 0; i < 16; i++) pal[i] = (uint16_t)rand();
+    for (int i = 0; i < w * h; i++) px[i] = (uint16_t)rand();
+    for (int i = 0; i < stride * h; i++) p4[i] = (uint8_t)rand();
+    if (four) LCD_BlitPal4(x, y, w, h, p4, pal);
+    else LCD_BlitRGB565(x, y, w, h, px);
+    for (int r = 0; r < h; r++)
+      for (int c = 0; c < w; c++) {
+        int X = x + c, Y = y + r;
+        if (X < 0 || Y < 0 || X >= 240 || Y >= 320) continue;
+        ref[Y][X] = four ? pal[(p4[r * stride + c / 2] >> ((c & 1) ? 0 : 4)) & 15] : px[r * w + c];
+      }
+    if (t % 100 == 99 && memcmp(ref, emu_gram, sizeof ref)) {
+      CHECK(0, "blit %d (%d,%d %dx%d %s) differs", t, x, y, w, h, four ? "pal4" : "rgb565");
+      break;
+    }
+  }
+}
+
+int main()
+{
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    const char *name = ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325";
+    char tag[64];
+
+    emu_reset(ctrl);
+    LCD_Initialization();
+    Random();
+
+    // Capture the old loops' output as the image to blit
+    LCD_Clear(Black);
+    emu_clear_counters();
+    Legacy_DisplayUFO(160, 24);
+    uint64_t old_stores = emu_stores();
+    snprintf(tag, sizeof tag, "%s UFO nested loops", name);
+    emu_print(tag);
+    memcpy(before, emu_gram, sizeof before);
+    memset(ufo4, 0, sizeof ufo4);
+    for (int r = 0; r < UFO_H; r++)
+      for (int c = 0; c < UFO_W; c++) {
+        uint16_t p = before[UFO_Y + r][UFO_X + c];
+        uint8_t i = 0;
+        while (palette[i] != p) i++;
+        ufo565[r * UFO_W + c] = p;
+        ufo4[r * UFO_W / 2 + c / 2] |= (uint8_t)(i << ((c & 1) ? 0 : 4));
+      }
+
+    emu_reset(ctrl);
+    LCD_Initialization();
+    LCD_Clear(Black);
+    emu_clear_counters();
+    LCD_BlitRGB565(UFO_X, UFO_Y, UFO_W, UFO_H, ufo565);
+    snprintf(tag, sizeof tag, "%s UFO BlitRGB565", name);
+    emu_print(tag);
+    CHECK(!memcmp(before, emu_gram, sizeof before), "RGB565 UFO differs");
+    CHECK(emu_stores() * 5 < old_stores, "RGB565 blit is not cheaper");
+
+    LCD_Clear(Black);
+    emu_clear_counters();
+    LCD_BlitPal4(UFO_X, UFO_Y, UFO_W, UFO_H, ufo4, palette);
+    snprintf(tag, sizeof tag, "%s UFO BlitPal4", name);
+    emu_print(tag);
+    CHECK(!memcmp(before, emu_gram, sizeof before), "pal4 UFO differs");
+    CHECK(emu_stores() * 5 < old_stores, "pal4 blit is not cheaper");
+
+    printf("%s host us/UFO: nested loops %.1f, BlitRGB565 %.1f, BlitPal4 %.1f\n", name,
+           HostMicros([] { Legacy_DisplayUFO(160, 24); }),
+           HostMicros([] { LCD_BlitRGB565(UFO_X, UFO_Y, UFO_W, UFO_H, ufo565); }),
+           HostMicros([] { LCD_BlitPal4(UFO_X, UFO_Y, UFO_W, UFO_H, ufo4, palette); }));
+  }
+  return emu_result();
+}
@@ -0,0 +1,93 @@
+// Boot to first frame on virtual time: fHALSetup runs against the bus
+// model with SysTick driven by the modelled bus time, so the init delays
+// and the first LCD_Clear add up to the time a real board would take.
+// The baseline boot, the same sequence with every delay a blocking
+// delay_ms and then the vendor clear, runs on the same clock for comparison.
+// Checks the registers against the vendor sequence, that the driver has
+// the horizontal entry mode it relies on, and that drawing then lands.
+#include "../../GLCD.c"
+#include "emu.h"
+#include "legacy.h"
+#include "bspHardwareAbstractionLayer.h"
+#include <stdio.h>
+#include <string.h>
+
+BOOL fHALSetup(void);
+
+static uint16_t shadow[320][240];
+
+static const LCD_InitSequence *Sequence(uint16_t code)
+{
+  for (unsigned i = 0; i < sizeof LCD_InitSequences / sizeof LCD_InitSequences[0]; i++)
+    if (LCD_InitSequences[i].DeviceCode == code) return &LCD_InitSequences[i];
+  return 0;
+}
+
+// Baseline LCD_Initialization and LCD_Clear; the ID read is left out
+static double BaselineBoot(const LCD_InitSequence *seq, int ctrl, uint16_t code)
+{
+  emu_reset(ctrl);
+  emu_device_code = code;
+  Legacy_DelayMs(100);
+  for (unsigned i = 0; i < seq->Count; i++) {
+    Legacy_WriteReg(seq->Steps[i].Reg, seq->Steps[i].Value);
+    if (seq->Steps[i].Delay) Legacy_DelayMs(seq->Steps[i].Delay);
+  }
+  Legacy_DelayMs(50);
+  Legacy_Clear(Black);
+  return emu_ns / 1e6;
+}
+
+int main()
+{
+  static const struct { int ctrl; uint16_t code; const char *name; } parts[] = {
+    { EMU_SSD1289, 0x8989, "SSD1289" },
+    { EMU_ILI9325, 0x9325, "ILI9325" },
+    { EMU_ILI9325, 0x9320, "ILI9320" },
+    { EMU_ILI9325, 0x1505, "R61505U" },
+  };
+
+  for (unsigned p = 0; p < sizeof parts / sizeof parts[0]; p++) {
+    const LCD_InitSequence *seq = Sequence(parts[p].code);
+    int ssd = parts[p].ctrl == EMU_SSD1289;
+    uint8_t entry = ssd ? 0x11 : 0x03;
+    uint32_t nominal = 100 + 50, waits = 2;
+    uint16_t last[256];
+    uint8_t written[256] = { 0 };
+
+    for (unsigned i = 0; i < seq->Count; i++) {
+      nominal += seq->Steps[i].Delay;
+      waits += seq->Steps[i].Delay != 0;
+      last[seq->Steps[i].Reg] = seq->Steps[i].Value;
+      written[seq->Steps[i].Reg] = 1;
+    }
+
+    double before = BaselineBoot(seq, parts[p].ctrl, parts[p].code);
+    emu_reset(parts[p].ctrl);
+    emu_device_code = parts[p].code;
+    fHALSetup();
+    double ms = emu_ns / 1e6;
+    printf("%s boot to first frame %7.1f ms virtual, %7.1f ms with delay_ms (%u ms of vendor delays, %u waits)\n",
+           parts[p].name, ms, before, nominal, waits);
+    // Each wait is padded by one 1 ms SysTick and ends on the next tick after that
+    CHECK(ms >= nominal && ms <= nominal + 2.0 * waits + 20.0, "%s boot took %.1f ms", parts[p].name, ms);
+
+    for (int r = 0; r < 256; r++) {
+      if (!written[r] || r == entry || r == 0x22) continue;
+      if (ssd ? (r >= 0x44 && r <= 0x46) || r == 0x4E || r == 0x4F
+              : (r >= 0x50 && r <= 0x53) || r == 0x20 || r == 0x21) continue;
+      CHECK(emu_reg[r] == last[r], "%s R%02X = %04X, sequence wrote %04X", parts[p].name, r, emu_reg[r], last[r]);
+    }
+    CHECK(emu_reg[entry] == ((last[entry] & ~0x38) | 0x30), "%s entry mode %04X after init",
+          parts[p].name, emu_reg[entry]);
+
+    memset(shadow, 0, sizeof shadow);
+    CHECK(!memcmp(shadow, emu_gram, sizeof shadow), "%s first frame is not black", parts[p].name);
+    LCD_FillRect(20, 30, 40, 50, Red);
+    for (int y = 30; y < 80; y++)
+      for (int x = 20; x < 60; x++) shadow[y][x] = Red;
+    for (int x = 100; x < 140; x++) { LCD_SetPoint(x, 200, Blue); shadow[200][x] = Blue; }
+    CHECK(!memcmp(shadow, emu_gram, sizeof shadow), "%s drawing after boot is misplaced", parts[p].name);
+  }
+  return emu_result();
+}
@@ -0,0 +1,148 @@
+// Cursor register writes (R20/R21 on ILI932x, R4E/R4F on SSD1289) per
+// drawing primitive with the driver's GRAM address counter model, and the
+// cases that must drop the model: a window change, a rotation and a read
+// session. Every pixel is also checked against a shadow of the screen.
+#include "emu.h"
+#include "GLCD.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t shadow[320][240];
+static uint16_t buf[64 * 64];
+static int regx, regy;
+
+static uint32_t CursorWrites(void)
+{
+  return emu_cnt.reg_writes[regx] + emu_cnt.reg_writes[regy];
+}
+
+static void Point(int x, int y, uint16_t c)
+{
+  LCD_SetPoint(x, y, c);
+  if (x < 240 && y < 320) shadow[y][x] = c;
+}
+
+static void Fill(int x, int y, int w, int h, uint16_t c)
+{
+  LCD_FillRect(x, y, w, h, c);
+  for (int j = y; j < y + h && j < 320; j++)
+    for (int i = x; i < x + w && i < 240; i++) shadow[j][i] = c;
+}
+
+// The ILI9325 reads GRAM back in BGR order, which GetPoint converts; the
+// model stores writes unswapped, so a read comes back with red and blue
+// exchanged there
+static uint16_t ReadBack(uint16_t c)
+{
+  if (emu_ctrl == EMU_SSD1289) return c;
+  return (uint16_t)(((c & 0x1F) << 11) | (c & 0x7E0) | (c >> 11));
+}
+
+static void Matches(const char *what)
+{
+  CHECK(!memcmp(shadow, emu_gram, sizeof shadow), "GRAM differs after %s", what);
+}
+
+// Cursor writes of one step, after which the next point must still land
+static uint32_t Step(const char *what, int x, int y, uint16_t c)
+{
+  emu_clear_counters();
+  Point(x, y, c);
+  Matches(what);
+  return CursorWrites();
+}
+
+int main()
+{
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    const char *name = ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325";
+    regx = ctrl == EMU_SSD1289 ? 0x4E : 0x20;
+    regy = ctrl == EMU_SSD1289 ? 0x4F : 0x21;
+    emu_reset(ctrl);
+    LCD_Initialization();
+    LCD_Clear(Black);
+    memset(shadow, 0, sizeof shadow);
+
+    emu_clear_counters();
+    for (int x = 10; x < 210; x++) Point(x, 100, (uint16_t)x);
+    printf("%s row of 200 points      %4u cursor writes\n", name, CursorWrites());
+    CHECK(CursorWrites() <= 2, "row of points rewrote the cursor");
+
+    emu_clear_counters();
+    for (int y = 0; y < 2; y++)
+      for (int x = 0; x < 240; x++) Point(x, 200 + y, (uint16_t)(x + y));
+    printf("%s two wrapping rows      %4u cursor writes\n", name, CursorWrites());
+    CHECK(CursorWrites() <= 2, "wrap to the next row rewrote the cursor");
+
+    emu_clear_counters();
+    for (int y = 0; y < 16; y++)
+      for (int x = 0; x < 8; x++) Point(50 + x, 50 + y, (uint16_t)(x * y));
+    printf("%s 8x16 block of points   %4u cursor writes\n", name, CursorWrites());
+    CHECK(CursorWrites() <= 2 * 16, "block rewrote the cursor inside rows");
+
+    emu_clear_counters();
+    for (int y = 120; y < 140; y++) Point(30, y, Red);
+    printf("%s column of 20 points    %4u cursor writes\n", name, CursorWrites());
+    CHECK(CursorWrites() <= 2 * 20, "column needs at most one setup a point");
+    Matches("runs of points");
+
+    // Each of these moves the controller's counter behind the model's back
+    Point(10, 60, Red);
+    Fill(100, 100, 20, 20, Green);
+    uint32_t n = Step("window change", 11, 60, Blue);
+    CHECK(n > 0, "point after a FillRect window trusted the old cursor");
+
+    Point(10, 61, Red);
+    (void)LCD_SetOrientation(0);
+    n = Step("rotation", 11, 61, Blue);
+    CHECK(n > 0, "point after LCD_SetOrientation trusted the old cursor");
+
+    Point(10, 62, Red);
+    (void)LCD_GetPoint(50, 50);
+    n = Step("GetPoint", 11, 62, Blue);
+    CHECK(n > 0, "point after GetPoint trusted the old cursor");
+
+    Point(10, 63, Red);
+    LCD_ReadRect(40, 40, 64, 64, buf);
+    n = Step("ReadRect", 11, 63, Blue);
+    CHECK(n > 0, "point after ReadRect trusted the old cursor");
+
+    // A rotated run still skips the setups once the model has been rebuilt
+    (void)LCD_SetOrientation(90);
+    emu_clear_counters();
+    for (int x = 10; x < 110; x++) LCD_SetPoint(x, 20, White);
+    printf("%s row of 100 at 90 deg   %4u cursor writes\n", name, CursorWrites());
+    CHECK(CursorWrites() <= 2, "rotated row rewrote the cursor");
+    (void)LCD_SetOrientation(0);
+
+    // Random mix of runs, rectangles and reads against the shadow
+    LCD_Clear(Black);
+    memset(shadow, 0, sizeof shadow);
+    srand(1);
+    for (int it = 0; it < 3000; it++) {
+      int op = rand() % 10, x = rand() % 260, y = rand() % 340;
+      uint16_t c = (uint16_t)rand();
+      if (op < 5) {
+        int len = rand() % 300;
+        for (int k = 0; k < len; k++) {
+          Point(x, y, (uint16_t)(c + k));
+          x++;
+          if (rand() % 50 == 0) x += 3;
+          if (x >= 240 && rand() % 2) { x = 0; y++; }
+        }
+      } else if (op < 7) {
+        Fill(x, y, rand() % 40, rand() % 40, c);
+      } else if (op < 8) {
+        if (x < 240 && y < 320) CHECK(LCD_GetPoint(x, y) == ReadBack(shadow[y][x]), "GetPoint(%d,%d)", x, y);
+      } else if (op < 9) {
+        if (x < 200 && y < 280) LCD_ReadRect(x, y, 40, 40, buf);
+      } else {
+        int len = rand() % 20;
+        for (int k = 0; k < len; k++) Point(x, y + k, c);
+      }
+    }
+    Matches("random mix");
+  }
+  return emu_result();
+}
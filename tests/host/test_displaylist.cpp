@@ -0,0 +1,116 @@
+// The display list against a per-pixel model: random frames of rects,
+// lines and text at partly off-screen positions, rendered band by band and
+// compared with GRAM. Then the line walk: a frame of full-height lines
+// crosses every band, and its host render time (bus off) shows whether
+// each band re-walks the line from its top.
+#include "emu.h"
+#include "bspDisplayList.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static uint16_t ref[320][240];
+
+static void Plot(int x, int y, uint16_t c)
+{
+  if (x >= 0 && x < 240 && y >= 0 && y < 320) ref[y][x] = c;
+}
+
+static void RefLine(int x0, int y0, int x1, int y1, uint16_t c)
+{
+  if (y1 < y0) { int t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  int dx = abs(x1 - x0), dy = y1 - y0, sx = x1 > x0 ? 1 : -1, e = dx - dy;
+  for (int x = x0, y = y0;;) {
+    Plot(x, y, c);
+    if (x == x1 && y == y1) break;
+    int e2 = 2 * e;
+    if (e2 > -dy) { e -= dy; x += sx; }
+    if (e2 < dx) { e += dx; y++; }
+  }
+}
+
+static void Frames(void)
+{
+  static const unsigned char text[] = "Hi UFO!";
+  int bad = 0;
+
+  srand(3);
+  for (int f = 0; f < 500; f++) {
+    memset(ref, 0, sizeof ref);
+    DisplayListBegin(0);
+    for (int n = rand() % DL_MAX_COMMANDS; n > 0; n--) {
+      uint16_t c = rand() | 1;
+      int x0 = rand() % 300 - 30, y0 = rand() % 380 - 30;
+      int x1 = rand() % 300 - 30, y1 = rand() % 380 - 30;
+      switch (rand() % 3) {
+      case 0: {
+        int w = rand() % 60, h = rand() % 60;
+        fDisplayListRect(x0, y0, w, h, c);
+        for (int y = y0; y < y0 + h; y++)
+          for (int x = x0; x < x0 + w; x++) Plot(x, y, c);
+        break;
+      }
+      case 1:
+        fDisplayListLine(x0, y0, x1, y1, c);
+        RefLine(x0, y0, x1, y1, c);
+        break;
+      default: {
+        uint8_t g[16];
+        fDisplayListText(x0, y0, text, c);
+        for (int i = 0; text[i]; i++) {
+          GetASCIICode(g, text[i]);
+          for (int r = 0; r < 16; r++)
+            for (int b = 0; b < 8; b++)
+              if ((g[r] >> (7 - b)) & 1) Plot(x0 + i * 8 + b, y0 + r, c);
+        }
+      }
+      }
+    }
+    wDisplayListRender();
+    if (memcmp(ref, emu_gram, sizeof ref) && bad++ < 3) CHECK(0, "frame %d differs from the model", f);
+  }
+}
+
+template <class F> static double HostMicros(F f)
+{
+  const int frames = 200;
+
+  emu_bus_off = 1;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; i++) f();
+  emu_bus_off = 0;
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / frames;
+}
+
+// Render time of full-height lines less that of a frame streaming the same
+// bands with a single line, which leaves the walking
+static void LineCost(void)
+{
+  memset(ref, 0, sizeof ref);
+  DisplayListBegin(0);
+  fDisplayListLine(0, 0, 239, 319, Red);
+  RefLine(0, 0, 239, 319, Red);
+  double one = HostMicros([] { wDisplayListRender(); });
+
+  for (int i = 1; i < DL_MAX_COMMANDS; i++) {
+    fDisplayListLine(i * 3, 0, 239 - i * 3, 319, Red);
+    RefLine(i * 3, 0, 239 - i * 3, 319, Red);
+  }
+  double all = HostMicros([] { wDisplayListRender(); });
+  wDisplayListRender();
+  CHECK(!memcmp(ref, emu_gram, sizeof ref), "full-height lines differ from the model");
+  printf("%d more full-height lines over %d bands: %.0f us a frame on the host\n",
+         DL_MAX_COMMANDS - 1, (320 + DL_BAND_ROWS - 1) / DL_BAND_ROWS, all - one);
+}
+
+int main()
+{
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  Frames();
+  LineCost();
+  return emu_result();
+}
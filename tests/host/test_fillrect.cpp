@@ -0,0 +1,71 @@
+// UFO and grenade drawn by the vendor per-pixel loops against the same
+// shapes drawn as 8x8 cell rectangles with LCD_FillRect; both must leave
+// identical GRAM, and the bus cost of each is printed.
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CELL 8
+
+static uint16_t before[320][240];
+
+// Landscape game coordinates, the display gets X and Y swapped
+static void FillCells(int x, int y, int columns, int rows, uint16_t color)
+{
+  LCD_FillRect(y, x, rows * CELL, columns * CELL, color);
+}
+
+static void CellUFO(int x, int y)
+{
+  for (int c = 0; c < 13; c++)
+    FillCells(x - 6 * CELL + c * CELL, y, 1, 1, (c & 1) ? 0xFFE0 : 0xF800);
+  FillCells(x - 4 * CELL, y - 1 * CELL, 9, 1, 0x001F);
+  FillCells(x - 4 * CELL, y + 1 * CELL, 9, 1, 0x001F);
+  FillCells(x - 3 * CELL, y - 2 * CELL, 7, 1, 0x001F);
+  FillCells(x - 3 * CELL, y + 2 * CELL, 7, 1, 0x001F);
+}
+
+static void CellGrenade(int x, int y)
+{
+  FillCells(x - 1 * CELL, y - 1 * CELL, 3, 3, 0xF81F);
+  FillCells(x, y + 2 * CELL, 1, 2, 0xF81F);
+}
+
+static void Scenario(int ctrl, const char *name, int legacy, uint64_t *stores, uint64_t *cycles)
+{
+  emu_reset(ctrl);
+  LCD_Initialization();
+  LCD_Clear(Black);
+  emu_clear_counters();
+  if (legacy) {
+    Legacy_DisplayUFO(160, 24);
+    Legacy_DisplayGrenade(160, 56);
+    Legacy_DisplayGrenade(100, 120);
+  } else {
+    CellUFO(160, 24);
+    CellGrenade(160, 56);
+    CellGrenade(100, 120);
+  }
+  char tag[64];
+  snprintf(tag, sizeof tag, "%s %s", ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325", name);
+  emu_print(tag);
+  *stores = emu_stores();
+  *cycles = emu_cnt.index_writes + emu_cnt.data_writes;
+}
+
+int main()
+{
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    uint64_t s0, c0, s1, c1;
+    Scenario(ctrl, "per-pixel loops", 1, &s0, &c0);
+    memcpy(before, emu_gram, sizeof before);
+    Scenario(ctrl, "cell FillRects", 0, &s1, &c1);
+    CHECK(!memcmp(before, emu_gram, sizeof before), "frames differ on controller %d", ctrl);
+    CHECK(s1 * 5 < s0, "FillRect %llu stores, per-pixel %llu", (unsigned long long)s1, (unsigned long long)s0);
+    printf("  bus transactions %llu -> %llu, GPIO stores %llu -> %llu\n",
+           (unsigned long long)c0, (unsigned long long)c1, (unsigned long long)s0, (unsigned long long)s1);
+  }
+  return emu_result();
+}
@@ -0,0 +1,234 @@
+// Blob fonts: text in every font of gen_fonts.c against a model that
+// decodes the blob independently from the layout documented in GLCD.h,
+// opaque and transparent, wrapping and clipped. Then the blend-table cache
+// of the anti-aliased font: hits, least-recently-used eviction and table
+// values. Last, throughput of the anti-aliased font against the 1-bit font
+// of the same height on the bus model, and the host cost of a cache miss.
+#include "emu.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "../../GLCD.c"
+#include "gen_fonts.h"
+
+#define FONTS 3
+#define COLUMNS 32
+
+struct Font {
+  int height;
+  int width[256];
+  uint8_t coverage[256][COLUMNS][32];  // [code][column][row], 0..15
+};
+
+static Font fonts[FONTS];
+static uint16_t model[320][240];
+static int clipX0, clipY0, clipX1, clipY1;
+
+static int Word(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+static void Decode(int index, Font *f)
+{
+  const uint8_t *font = gabyFontBlob + Word(gabyFontBlob + 1 + 2 * index);
+  int fgBits = font[3];
+
+  memset(f, 0, sizeof *f);
+  f->height = font[0];
+  for (int code = font[1]; code <= font[2]; code++) {
+    const uint8_t *glyph = font + Word(font + 4 + 2 * (code - font[1]));
+    const uint8_t *end = font + Word(font + 6 + 2 * (code - font[1]));
+    int pos = 0;
+
+    f->width[code] = glyph[0];
+    for (glyph++; glyph < end; glyph++) {
+      int runs[2][2], n = 0;
+      if (fgBits == 0) {
+        runs[n][0] = *glyph >> 4; runs[n++][1] = (*glyph & 15) + 1;
+      } else {
+        runs[n][0] = 0; runs[n++][1] = *glyph >> fgBits;
+        runs[n][0] = 15; runs[n++][1] = *glyph & ((1 << fgBits) - 1);
+      }
+      for (int r = 0; r < n; r++)
+        for (int k = 0; k < runs[r][1]; k++, pos++)
+          f->coverage[code][pos / f->height][pos % f->height] = runs[r][0];
+    }
+  }
+}
+
+static uint16_t Blend(uint16_t fg, uint16_t bg, int a)
+{
+  int r = ((fg >> 11) * a + (bg >> 11) * (15 - a) + 7) / 15;
+  int g = (((fg >> 5) & 63) * a + ((bg >> 5) & 63) * (15 - a) + 7) / 15;
+  int b = ((fg & 31) * a + (bg & 31) * (15 - a) + 7) / 15;
+  return (r << 11) | (g << 5) | b;
+}
+
+static void Plot(int x, int y, uint16_t c)
+{
+  if (x >= clipX0 && x < clipX1 && y >= clipY0 && y < clipY1 && x < 240 && y < 320) model[y][x] = c;
+}
+
+static int ModelChar(const Font *f, int x, int y, uint8_t code, uint16_t fg, uint16_t bg, int transparent)
+{
+  for (int c = 0; c < f->width[code]; c++)
+    for (int r = 0; r < f->height; r++) {
+      int a = f->coverage[code][c][r];
+      if (a || !transparent) Plot(x + c, y + r, Blend(fg, bg, a));
+    }
+  return f->width[code];
+}
+
+static void ModelText(const Font *f, int x, int y, const uint8_t *s, uint16_t fg, uint16_t bg, int transparent)
+{
+  while (*s) {
+    x += ModelChar(f, x, y, *s++, fg, bg, transparent);
+    if (x >= 240) { x = 0; y = (y < 320 - f->height) ? y + f->height : 0; }
+  }
+}
+
+static void Differential(void)
+{
+  static const uint16_t colors[6] = { White, Black, Red, Green, Blue, 0x8410 };
+
+  LCD_Clear(Black);
+  memset(model, 0, sizeof model);
+  srand(7);
+  for (int i = 0; i < 600; i++) {
+    int index = rand() % FONTS, transparent = rand() & 1, clip = rand() % 3 == 0, n = rand() % 70;
+    const Font *f = &fonts[index];
+    uint8_t s[80];
+    int width = 0;
+
+    CHECK(LCD_SetFont(gabyFontBlob, index), "font %d refused", index);
+    LCD_SetTextMode(transparent ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+    clipX0 = 0; clipY0 = 0; clipX1 = 240; clipY1 = 320;
+    if (clip) {
+      clipX0 = rand() % 200; clipY0 = rand() % 280;
+      clipX1 = clipX0 + rand() % 40 + 1; clipY1 = clipY0 + rand() % 40 + 1;
+      LCD_PushClip(clipX0, clipY0, clipX1 - clipX0, clipY1 - clipY0);
+    }
+    for (int k = 0; k < n; k++) width += f->width[s[k] = rand() % 6 == 0 ? 1 + rand() % 255 : 32 + rand() % 95];
+    s[n] = 0;
+    CHECK(LCD_TextWidth(s) == width && LCD_FontHeight() == f->height, "font %d measures %d x %d, not %d x %d",
+          index, LCD_TextWidth(s), LCD_FontHeight(), width, f->height);
+
+    int x = rand() % 245, y = rand() % 325;
+    uint16_t fg = rand() % 2 ? rand() : colors[rand() % 6], bg = rand() % 2 ? rand() : colors[rand() % 6];
+    if (rand() % 4 == 0 && n) {
+      LCD_PutChar(x, y, s[0], fg, bg);
+      ModelChar(f, x, y, s[0], fg, bg, transparent);
+    } else {
+      LCD_PutText(x, y, s, fg, bg);
+      ModelText(f, x, y, s, fg, bg, transparent);
+    }
+    if (clip) LCD_PopClip();
+    if (memcmp(model, emu_gram, sizeof model)) {
+      CHECK(0, "text %d in font %d at (%d,%d), %s%s, differs from the model", i, index, x, y,
+            transparent ? "transparent" : "opaque", clip ? ", clipped" : "");
+      break;
+    }
+  }
+  CHECK(!LCD_SetFont(gabyFontBlob, FONTS), "font %d accepted", FONTS);
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+  LCD_SetFont(NULL, 0);
+}
+
+static int Cached(uint16_t fg, uint16_t bg)
+{
+  for (int k = 0; k < LCD_BlendUsed; k++)
+    if (LCD_BlendCache[LCD_BlendOrder[k]].fg == fg && LCD_BlendCache[LCD_BlendOrder[k]].bg == bg) return k;
+  return -1;
+}
+
+// Pairs are (i, ~i): LCD_BLEND_CACHE of them fill the cache
+static void BlendCache(void)
+{
+  const uint16_t *first, *lut;
+
+  LCD_BlendUsed = 0;
+  first = LCD_BlendColors(1, ~1);
+  for (int a = 0; a < 16; a++) CHECK(first[a] == Blend(1, ~1, a), "coverage %d blends to %04x", a, first[a]);
+  for (uint16_t i = 2; i <= LCD_BLEND_CACHE; i++) LCD_BlendColors(i, ~i);
+  CHECK(LCD_BlendUsed == LCD_BLEND_CACHE, "%d tables for %d pairs", LCD_BlendUsed, LCD_BLEND_CACHE);
+  CHECK(Cached(1, ~1) == LCD_BLEND_CACHE - 1, "the first pair is not the least recently used");
+
+  // A hit returns the same table and makes it the most recently used
+  CHECK(LCD_BlendColors(1, ~1) == first && Cached(1, ~1) == 0, "hit on the first pair");
+
+  // A miss replaces the least recently used pair, now the second one
+  lut = LCD_BlendColors(0x1234, 0x4321);
+  CHECK(Cached(2, ~2) < 0, "the least recently used pair was kept");
+  CHECK(Cached(1, ~1) == 1 && Cached(0x1234, 0x4321) == 0, "eviction order");
+  for (int a = 0; a < 16; a++) CHECK(lut[a] == Blend(0x1234, 0x4321, a), "rebuilt table at coverage %d", a);
+  for (uint16_t i = 3; i <= LCD_BLEND_CACHE; i++) CHECK(Cached(i, ~i) > 0, "pair %d evicted", i);
+}
+
+template <class F> static double HostMicros(F f)
+{
+  const int runs = 200;
+
+  emu_bus_off = 1;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) f();
+  emu_bus_off = 0;
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / runs;
+}
+
+static const uint8_t text[] = "abcdefghijklmnopqrstuvwxyzABCD";
+
+static void Lines(uint16_t fg)
+{
+  for (int y = 0; y < 10; y++) LCD_PutText(0, y * 16, (uint8_t *)text, fg, Black);
+}
+
+// Cycling through LCD_BLEND_CACHE pairs always hits; one more always
+// misses, as the least recently used pair is the next one asked for
+static double BlendNanos(int pairs)
+{
+  const int calls = 1000000;
+  volatile uint16_t sink = 0;
+
+  LCD_BlendUsed = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < calls; i++) sink += LCD_BlendColors(i % pairs, 0)[8];
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / calls;
+}
+
+static void Throughput(void)
+{
+  static const char *names[FONTS] = { "Small", "System", "Smooth" };
+
+  for (int index = FONT_SYSTEM; index < FONTS; index++)
+    for (int transparent = 0; transparent < 2; transparent++) {
+      uint64_t ns;
+      LCD_SetFont(gabyFontBlob, index);
+      LCD_SetTextMode(transparent ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+      LCD_Clear(Black);
+      emu_clear_counters();
+      ns = emu_ns;
+      Lines(White);
+      ns = emu_ns - ns;
+      printf("%-7s %-11s %6.1f stores/glyph %7.0f glyphs/s\n", names[index], transparent ? "transparent" : "opaque",
+             (double)emu_stores() / 300, 300 * 1e9 / ns);
+    }
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+  LCD_SetFont(gabyFontBlob, FONT_SYSTEM);
+  double bits = HostMicros([] { Lines(White); });
+  LCD_SetFont(gabyFontBlob, FONT_SMOOTH);
+  double smooth = HostMicros([] { Lines(White); });
+  printf("300 glyphs on the host, bus off: System %.0f us, Smooth %.0f us\n", bits, smooth);
+  printf("LCD_BlendColors on the host: %.1f ns a hit, %.1f ns a miss\n",
+         BlendNanos(LCD_BLEND_CACHE), BlendNanos(LCD_BLEND_CACHE + 1));
+  LCD_SetFont(NULL, 0);
+}
+
+int main()
+{
+  for (int i = 0; i < FONTS; i++) Decode(i, &fonts[i]);
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  Differential();
+  BlendCache();
+  Throughput();
+  return emu_result();
+}
@@ -0,0 +1,131 @@
+// Headless run of the game in the render mode given by UFO_RENDER_MODE:
+// random joystick events for a few thousand frames, GRAM after every frame
+// compared with a black screen plus every sprite at its current position
+// (so any trail fails), and the pixels written per frame against the
+// clear-and-redraw the game used to do. The RENDER_SPRITES builds also check
+// scbySubtractRect, the footprint subtraction behind the sprite erase,
+// including the case where its piece list overflows MAX_ERASE_RECTS.
+#include "emu.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "apUFO.c"
+
+#define FRAMES 3000
+#define GRID   64
+
+static uint16_t shadow[320][240];
+
+static void Paint(const SPRITE_T *s, int x, int y)
+{
+  const BYTE *pix = s->pbyPixels;
+
+  for (int r = 0; r < s->byRunCount; r++) {
+    const SPRITE_RUN_T *run = &s->psRuns[r];
+    int stride = (run->byWidth + 1) / 2;
+    for (int j = 0; j < run->byHeight; j++)
+      for (int i = 0; i < run->byWidth; i++) {
+        int X = x + run->byX + i, Y = y + run->byY + j;
+        uint8_t b = pix[j * stride + i / 2];
+        if (X >= 0 && X < 240 && Y >= 0 && Y < 320)
+          shadow[Y][X] = s->pwPalette[(i & 1) ? (b & 15) : (b >> 4)];
+      }
+    pix += stride * run->byHeight;
+  }
+}
+
+#if (UFO_RENDER_MODE == RENDER_SPRITES)
+static RECT_T RandomRect(void)
+{
+  RECT_T r;
+  r.sdwX0 = rand() % GRID;
+  r.sdwY0 = rand() % GRID;
+  r.sdwX1 = r.sdwX0 + 1 + rand() % (GRID - r.sdwX0);
+  r.sdwY1 = r.sdwY0 + 1 + rand() % (GRID - r.sdwY0);
+  return r;
+}
+
+static int Inside(const RECT_T *r, int x, int y)
+{
+  return x >= r->sdwX0 && x < r->sdwX1 && y >= r->sdwY0 && y < r->sdwY1;
+}
+
+// The pieces left must stay inside the old footprint and still hold every
+// part of it no cover hides; overlapping covers or an overflow may only
+// leave more to erase, never less
+static void SubtractRect(void)
+{
+  RECT_T pieces[MAX_ERASE_RECTS], covers[32];
+  int overflowed = 0;
+
+  srand(10);
+  for (int t = 0; t < 20000; t++) {
+    RECT_T old = RandomRect();
+    int n = 1 + rand() % 32, count = 1;
+    // Every other run uses small covers inside the piece, which splits it
+    // into many pieces and overflows the list
+    for (int c = 0; c < n; c++) {
+      covers[c] = RandomRect();
+      if (t & 1) {
+        covers[c].sdwX1 = covers[c].sdwX0 + 1 + rand() % 3;
+        covers[c].sdwY1 = covers[c].sdwY0 + 1 + rand() % 3;
+      }
+    }
+    pieces[0] = old;
+    for (int c = 0; c < n && count > 0; c++) {
+      int before = count;
+      count = scbySubtractRect(pieces, (BYTE)count, &covers[c]);
+      CHECK(count <= MAX_ERASE_RECTS, "%d pieces", count);
+      if (count == before && before + 3 > MAX_ERASE_RECTS) overflowed++;
+    }
+    for (int y = 0; y < GRID; y++)
+      for (int x = 0; x < GRID; x++) {
+        int kept = 0, hidden = 0;
+        for (int p = 0; p < count; p++) kept |= Inside(&pieces[p], x, y);
+        for (int c = 0; c < n; c++) hidden |= Inside(&covers[c], x, y);
+        if (kept && !Inside(&old, x, y)) { CHECK(0, "run %d erases (%d,%d) outside the footprint", t, x, y); return; }
+        if (Inside(&old, x, y) && !hidden && !kept) { CHECK(0, "run %d leaves a trail at (%d,%d)", t, x, y); return; }
+      }
+  }
+  printf("scbySubtractRect: 20000 runs, %d hit the %d piece limit\n", overflowed, MAX_ERASE_RECTS);
+  CHECK(overflowed > 0, "the piece limit was never reached");
+}
+#endif
+
+int main()
+{
+  uint64_t px = 0, stores = 0;
+  int bad = 0;
+
+#if (UFO_RENDER_MODE == RENDER_SPRITES)
+  SubtractRect();
+#endif
+
+  emu_reset(EMU_SSD1289);
+  InitUFOApp();
+  srand(3);
+  for (int f = 0; f < FRAMES; f++) {
+    int e = rand() % 6;
+    if (e == 0) scGrenadeCallback();
+    else if (e == 1) scUFOLeftCallback();
+    else if (e == 2) scUFORightCallback();
+    emu_clear_counters();
+    scRefreshLCDCallback();
+    px += emu_cnt.gram_writes;
+    stores += emu_stores();
+    memset(shadow, 0, sizeof shadow);
+    for (int i = 0; i < SPRITE_SLOTS; i++)
+      Paint(scasSlots[i].psSprite, (int16_t)scasSlots[i].wX, (int16_t)scasSlots[i].wY);
+    if (memcmp(shadow, emu_gram, sizeof shadow) && bad++ < 3) CHECK(0, "frame %d differs from the scene", f);
+  }
+
+  // What the original loop wrote: a full clear plus every sprite pixel
+  uint64_t sprites = 0;
+  for (int i = 0; i < SPRITE_SLOTS; i++)
+    for (int r = 0; r < scasSlots[i].psSprite->byRunCount; r++)
+      sprites += scasSlots[i].psSprite->psRuns[r].byWidth * scasSlots[i].psSprite->psRuns[r].byHeight;
+  printf("render mode %d: %llu px/frame (clear and redraw: %llu), %llu GPIO stores/frame\n",
+         UFO_RENDER_MODE, (unsigned long long)(px / FRAMES), (unsigned long long)(240 * 320 + sprites),
+         (unsigned long long)(stores / FRAMES));
+  return emu_result();
+}
@@ -0,0 +1,100 @@
+// HUD fields: HudFormatNumber cases, then random updates of a field checked
+// against the whole field drawn in AsciiLib cells, with a blob font and
+// transparent text selected in between, which must not change the cells.
+// Reports the stores an update costs against redrawing the field.
+#include "emu.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+#include "bspHudField.h"
+#include "gen_fonts.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FIELD_X     16
+#define FIELD_Y     40
+#define FIELD_CELLS 6
+
+static uint16_t model[320][240];
+
+static void ModelField(const BYTE *text, uint16_t fg, uint16_t bg)
+{
+  uint8_t glyph[16];
+
+  for (int i = 0; i < FIELD_CELLS; i++) {
+    GetASCIICode(glyph, text[i]);
+    for (int r = 0; r < 16; r++)
+      for (int c = 0; c < 8; c++)
+        model[FIELD_Y + r][FIELD_X + i * 8 + c] = ((glyph[r] >> (7 - c)) & 1) ? fg : bg;
+  }
+}
+
+static void Format(void)
+{
+  static const struct { DWORD value; BYTE digits, pad; const char *text; } cases[] = {
+    { 0, 6, '0', "000000" }, { 42, 6, ' ', "    42" }, { 123456, 6, '0', "123456" },
+    { 1234567, 6, '0', "999999" }, { 7, 1, '0', "7" }, { 10, 1, '0', "9" },
+    { 4294967295u, 10, ' ', "4294967295" }, { 5, 0, '0', "" },
+  };
+  BYTE text[16];
+
+  for (unsigned i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+    HudFormatNumber(text, cases[i].value, cases[i].digits, cases[i].pad);
+    CHECK(!strcmp((char *)text, cases[i].text), "%u in %d digits gives \"%s\"", cases[i].value, cases[i].digits, text);
+  }
+}
+
+int main()
+{
+  HUD_FIELD_T field;
+  BYTE text[FIELD_CELLS + 1];
+  uint64_t stores = 0, cells = 0;
+  int bad = 0;
+
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  LCD_Clear(Black);
+  Format();
+
+  HudFieldInit(&field, FIELD_X, FIELD_Y, FIELD_CELLS, White, Blue);
+  srand(3);
+  for (int i = 0; i < 1000; i++) {
+    // Whatever the rest of the screen uses
+    LCD_SetFont(rand() % 2 ? gabyFontBlob : NULL, rand() % 3);
+    LCD_SetTextMode(rand() % 2 ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+
+    emu_clear_counters();
+    if (rand() % 5 == 0) {
+      int n = rand() % (FIELD_CELLS + 1);
+      for (int k = 0; k < n; k++) text[k] = 32 + rand() % 95;
+      text[n] = 0;
+      cells += byHudFieldSetText(&field, text);
+      memset(text + n, ' ', FIELD_CELLS - n);
+    } else {
+      DWORD value = rand() % (rand() % 2 ? 1000000 : 200);
+      BYTE pad = rand() % 2 ? '0' : ' ';
+      cells += byHudFieldSetNumber(&field, value, pad);
+      HudFormatNumber(text, value, FIELD_CELLS, pad);
+    }
+    stores += emu_stores();
+
+    memcpy(model, emu_gram, sizeof model);
+    ModelField(text, White, Blue);
+    if (memcmp(model, emu_gram, sizeof model) && bad++ < 3) CHECK(0, "update %d: field differs from \"%.6s\"", i, text);
+  }
+  LCD_SetFont(NULL, 0);
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+
+  printf("random updates: %.2f cells, %.0f stores each\n", (double)cells / 1000, (double)stores / 1000);
+
+  // A score counting up changes one or two digits at a time
+  cells = 0;
+  emu_clear_counters();
+  for (DWORD value = 1; value <= 1000; value++) cells += byHudFieldSetNumber(&field, value, '0');
+  printf("score counting up: %.2f cells, %.0f stores each\n", (double)cells / 1000, (double)emu_stores() / 1000);
+
+  emu_clear_counters();
+  LCD_PutChars(FIELD_X, FIELD_Y, text, FIELD_CELLS, White, Blue);
+  printf("the whole field: %llu stores\n", (unsigned long long)emu_stores());
+  return emu_result();
+}
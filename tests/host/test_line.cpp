@@ -0,0 +1,122 @@
+// LCD_DrawLine against a reference Bresenham in every octant, with end
+// points far off-screen and random clip rectangles, then the bus cost of
+// shallow, steep and diagonal lines in stores per pixel and pixels per
+// second of virtual bus time. The old vendor line is only right for
+// positive slopes, so it is compared on those.
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t ref[320][240];
+static int clipX0, clipY0, clipX1, clipY1;
+
+static void Plot(int x, int y, uint16_t c)
+{
+  if (x >= clipX0 && x < clipX1 && y >= clipY0 && y < clipY1 &&
+      x >= 0 && x < 240 && y >= 0 && y < 320)
+    ref[y][x] = c;
+}
+
+// Midpoint Bresenham along the major axis, walked in increasing order
+static void RefLine(int x0, int y0, int x1, int y1, uint16_t c)
+{
+  int steep = abs(y1 - y0) > abs(x1 - x0), t;
+  if (steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+  if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+  int du = x1 - x0, dv = abs(y1 - y0), sv = y1 >= y0 ? 1 : -1, d = 2 * dv - du, v = y0;
+  for (int u = x0; u <= x1; u++) {
+    if (steep) Plot(v, u, c); else Plot(u, v, c);
+    if (d > 0) { v += sv; d -= 2 * du; }
+    d += 2 * dv;
+  }
+}
+
+static void Differential(void)
+{
+  int bad = 0;
+
+  srand(9);
+  for (int i = 0; i < 20000; i++) {
+    int r = rand() % 3, span = r == 0 ? 60 : r == 1 ? 400 : 2000;
+    int x0 = rand() % span - span / 2 + 120, y0 = rand() % span - span / 2 + 160;
+    int x1 = rand() % span - span / 2 + 120, y1 = rand() % span - span / 2 + 160;
+    int clip = rand() % 2;
+    uint16_t c = rand() | 1;
+
+    if (rand() % 8 == 0) x1 = x0;
+    if (rand() % 8 == 0) y1 = y0;
+    clipX0 = 0; clipY0 = 0; clipX1 = 240; clipY1 = 320;
+    if (clip) {
+      clipX0 = rand() % 250 - 5; clipY0 = rand() % 330 - 5;
+      clipX1 = clipX0 + rand() % 150; clipY1 = clipY0 + rand() % 150;
+    }
+    memset(ref, 0, sizeof ref);
+    LCD_Clear(0);
+    if (clip) LCD_PushClip(clipX0, clipY0, clipX1 - clipX0, clipY1 - clipY0);
+    LCD_DrawLine(x0, y0, x1, y1, c);
+    if (clip) LCD_PopClip();
+    RefLine(x0, y0, x1, y1, c);
+    if (memcmp(ref, emu_gram, sizeof ref) && bad++ < 3)
+      CHECK(0, "(%d,%d)-(%d,%d) clip %d: %d,%d-%d,%d", x0, y0, x1, y1, clip, clipX0, clipY0, clipX1, clipY1);
+  }
+}
+
+// Random on-screen lines of one kind: 0 shallow, 1 steep, 2 diagonal,
+// 3 shallow with a positive slope
+static void RandomLine(int kind, int *x0, int *y0, int *x1, int *y1)
+{
+  *x0 = rand() % 240; *y0 = rand() % 320;
+  if (kind == 0) { *x1 = rand() % 240; *y1 = *y0 + rand() % 9 - 4; }
+  else if (kind == 1) { *y1 = rand() % 320; *x1 = *x0 + rand() % 9 - 4; }
+  else if (kind == 2) { int d = rand() % 100; *x1 = *x0 + d; *y1 = *y0 + d; }
+  else { *x1 = *x0 + rand() % 100; if (*x1 > 239) *x1 = 239; *y1 = *y0 + rand() % (*x1 - *x0 + 1); }
+  if (*x1 > 239) *x1 = 239;
+  if (*y1 < 0) *y1 = 0;
+  if (*y1 > 319) *y1 = 319;
+}
+
+typedef void (*LineFn)(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
+
+static void Cost(const char *tag, int kind, LineFn line)
+{
+  uint64_t px = 0, stores = 0, ns = emu_ns;
+
+  srand(1);
+  emu_clear_counters();
+  for (int i = 0; i < 2000; i++) {
+    int x0, y0, x1, y1;
+    RandomLine(kind, &x0, &y0, &x1, &y1);
+    line(x0, y0, x1, y1, White);
+  }
+  px = emu_cnt.gram_writes;
+  stores = emu_stores();
+  ns = emu_ns - ns;
+  printf("%-24s %5.1f stores/px  %5.2f Mpx/s\n", tag, (double)stores / px, px * 1e3 / ns);
+}
+
+int main()
+{
+  static uint16_t drawn[320][240];
+
+  emu_reset(EMU_ILI9325);
+  LCD_Initialization();
+  Differential();
+
+  Cost("shallow", 0, LCD_DrawLine);
+  Cost("steep", 1, LCD_DrawLine);
+  Cost("diagonal", 2, LCD_DrawLine);
+  LCD_Clear(Black);
+  Cost("positive slope", 3, LCD_DrawLine);
+  memcpy(drawn, emu_gram, sizeof drawn);
+
+  // The vendor line bypasses the cursor model, so on a fresh controller
+  emu_reset(EMU_ILI9325);
+  LCD_Initialization();
+  LCD_Clear(Black);
+  Cost("positive slope, vendor", 3, Legacy_DrawLine);
+  CHECK(!memcmp(drawn, emu_gram, sizeof drawn), "the vendor line draws other pixels");
+  return emu_result();
+}
@@ -0,0 +1,157 @@
+// Drawing in all four orientations against a model of the turned screen:
+// blits, fills, points, column sessions, characters and read-back, on both
+// controllers. Then the host cost of LCD_SetPoint (bus off) at 0 and 90
+// degrees, the case the per-point coordinate mapping weighs on.
+#include "emu.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+static uint16_t model[320 * 320];     // turned screen, width * height
+static uint16_t img[320 * 320], buf[320 * 320];
+static int width, height, rotation, ili;
+
+// The ILI9325 stores what it reads back with red and blue swapped
+static uint16_t Stored(uint16_t c)
+{
+  return ili ? (uint16_t)(((c & 0x1F) << 11) | (c & 0x7E0) | (c >> 11)) : c;
+}
+
+static void Map(int x, int y, int *px, int *py)
+{
+  switch (rotation) {
+  case 0: *px = x; *py = y; break;
+  case 1: *px = y; *py = 319 - x; break;
+  case 2: *px = 239 - x; *py = 319 - y; break;
+  default: *px = 239 - y; *py = x; break;
+  }
+}
+
+static void Sync(void)
+{
+  for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++) {
+      int px, py;
+      Map(x, y, &px, &py);
+      model[y * width + x] = Stored(emu_gram[py][px]);
+    }
+}
+
+static void Compare(const char *what)
+{
+  int bad = 0;
+
+  for (int y = 0; y < height; y++)
+    for (int x = 0; x < width; x++) {
+      int px, py;
+      Map(x, y, &px, &py);
+      bad += emu_gram[py][px] != Stored(model[y * width + x]);
+    }
+  CHECK(!bad, "%s, controller %d at %d degrees: %d pixels differ", what, ili, rotation * 90, bad);
+}
+
+static void Draw(void)
+{
+  for (int i = 0; i < 60; i++) {
+    int w = rand() % 60 + 1, h = rand() % 60 + 1, x = rand() % (width + 40) - 20, y = rand() % (height + 40) - 20;
+    for (int k = 0; k < w * h; k++) img[k] = rand();
+    LCD_BlitRGB565(x, y, w, h, img);
+    for (int r = 0; r < h; r++)
+      for (int c = 0; c < w; c++)
+        if (x + c >= 0 && y + r >= 0 && x + c < width && y + r < height) model[(y + r) * width + x + c] = img[r * w + c];
+
+    int fx = rand() % width, fy = rand() % height, fw = rand() % 50 + 1, fh = rand() % 50 + 1;
+    uint16_t color = rand();
+    LCD_FillRect(fx, fy, fw, fh, color);
+    for (int r = 0; r < fh; r++)
+      for (int c = 0; c < fw; c++)
+        if (fx + c < width && fy + r < height) model[(fy + r) * width + fx + c] = color;
+
+    // Neighbouring points reuse the cursor
+    for (int k = 0; k < 20; k++) {
+      int px = rand() % (width - 1), py = rand() % height;
+      color = rand();
+      LCD_SetPoint(px, py, color);
+      LCD_SetPoint(px + 1, py, color ^ 1);
+      model[py * width + px] = color;
+      model[py * width + px + 1] = color ^ 1;
+    }
+
+    int cx = rand() % (width - 30), cy = rand() % (height - 30), cw = rand() % 30 + 1, ch = rand() % 30 + 1;
+    for (int k = 0; k < cw * ch; k++) img[k] = rand();
+    CHECK(LCD_BeginWriteColumns(cx, cy, cw, ch), "no column session at %d degrees", rotation * 90);
+    LCD_WritePixels(img, cw * ch);
+    LCD_EndWrite();
+    for (int c = 0; c < cw; c++)
+      for (int r = 0; r < ch; r++) model[(cy + r) * width + cx + c] = img[c * ch + r];
+  }
+  Compare("drawing");
+
+  int x = rand() % (width - 8), y = rand() % (height - 16);
+  uint8_t glyph[16];
+  GetASCIICode(glyph, 'A');
+  LCD_PutChar(x, y, 'A', White, 0x1234);
+  for (int r = 0; r < 16; r++)
+    for (int c = 0; c < 8; c++) model[(y + r) * width + x + c] = ((glyph[r] >> (7 - c)) & 1) ? White : 0x1234;
+  Compare("character");
+
+  Sync();
+  int bad = 0;
+  for (int i = 0; i < 50; i++) {
+    int rx = rand() % width, ry = rand() % height, rw = rand() % (width - rx) + 1, rh = rand() % (height - ry) + 1;
+    LCD_ReadRect(rx, ry, rw, rh, buf);
+    for (int r = 0; r < rh; r++)
+      for (int c = 0; c < rw; c++) bad += buf[r * rw + c] != model[(ry + r) * width + rx + c];
+  }
+  CHECK(!bad, "read-back, controller %d at %d degrees: %d pixels differ", ili, rotation * 90, bad);
+}
+
+// Scattered points, each needing its own cursor; best of five runs
+static double PointNanos(void)
+{
+  static uint16_t xs[100000], ys[100000];
+  const int points = 100000;
+  double best = 1e9;
+
+  srand(5);
+  for (int i = 0; i < points; i++) { xs[i] = rand() % width; ys[i] = rand() % height; }
+  emu_bus_off = 1;
+  for (int run = 0; run < 5; run++) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < points; i++) LCD_SetPoint(xs[i], ys[i], i);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / points;
+    if (ns < best) best = ns;
+  }
+  emu_bus_off = 0;
+  return best;
+}
+
+int main()
+{
+  for (ili = 0; ili < 2; ili++) {
+    emu_reset(ili ? EMU_ILI9325 : EMU_SSD1289);
+    emu_bgr_model = 1;
+    LCD_Initialization();
+    srand(11);
+    for (rotation = 0; rotation < 4; rotation++) {
+      CHECK(LCD_SetOrientation(rotation * 90), "%d degrees refused", rotation * 90);
+      width = LCD_GetWidth();
+      height = LCD_GetHeight();
+      Sync();
+      Draw();
+    }
+  }
+
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  for (rotation = 0; rotation < 2; rotation++) {
+    LCD_SetOrientation(rotation * 90);
+    width = LCD_GetWidth();
+    height = LCD_GetHeight();
+    printf("LCD_SetPoint at %2d degrees: %.1f ns a point on the host\n", rotation * 90, PointNanos());
+  }
+  return emu_result();
+}
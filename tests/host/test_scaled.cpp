@@ -0,0 +1,186 @@
+// Integer-scaled drawing against a per-pixel model: LCD_BlitScaled,
+// LCD_BlitPal4Scaled and LCD_PutCharScaled at random, partly clipped
+// positions, then enlarged sizes past 16 bits, which must be clipped and
+// not wrap into a small rectangle, and BlitSpriteScaled. Reports the
+// stores of the scaled UFO and glyphs.
+#include "emu.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+#include "bspHardwareAbstractionLayer.h"
+#include "gen_sprites.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOURCE 2048
+
+static uint16_t model[320][240];
+static uint16_t src[SOURCE];
+static uint8_t src4[SOURCE / 2];
+static uint16_t palette[16];
+static int clipX0, clipY0, clipX1, clipY1;
+
+// Source pixel shown at each screen pixel of a bitmap enlarged Scale times
+template <class F> static void Model(int x0, int y0, int w, int h, int scale, F pixel)
+{
+  for (int y = clipY0; y < clipY1; y++)
+    for (int x = clipX0; x < clipX1; x++) {
+      long dx = (long)x - x0, dy = (long)y - y0;
+      if (dx >= 0 && dy >= 0 && dx < (long)w * scale && dy < (long)h * scale) {
+        int c = pixel((int)(dx / scale), (int)(dy / scale));
+        if (c >= 0) model[y][x] = c;
+      }
+    }
+}
+
+static void ModelRGB(int x, int y, int w, int h, int scale)
+{
+  Model(x, y, w, h, scale, [w](int sx, int sy) { return (int)src[sy * w + sx]; });
+}
+
+static void ModelPal4(int x, int y, int w, int h, int scale)
+{
+  int stride = (w + 1) / 2;
+  Model(x, y, w, h, scale, [stride](int sx, int sy) {
+    uint8_t b = src4[sy * stride + sx / 2];
+    return (int)palette[(sx & 1) ? b & 15 : b >> 4];
+  });
+}
+
+static void ModelChar(int x, int y, uint8_t code, uint16_t fg, uint16_t bg, int scale, int transparent)
+{
+  uint8_t glyph[16];
+
+  GetASCIICode(glyph, code);
+  Model(x, y, 8, 16, scale, [&](int sx, int sy) {
+    return ((glyph[sy] >> (7 - sx)) & 1) ? (int)fg : transparent ? -1 : (int)bg;
+  });
+}
+
+static int Same(void)
+{
+  return !memcmp(model, emu_gram, sizeof model);
+}
+
+static void Random(void)
+{
+  for (int i = 0; i < 500; i++) {
+    int clip = rand() % 2;
+    clipX0 = 0; clipY0 = 0; clipX1 = 240; clipY1 = 320;
+    if (clip) {
+      clipX0 = rand() % 200; clipY0 = rand() % 280;
+      clipX1 = clipX0 + rand() % 60 + 1; clipY1 = clipY0 + rand() % 60 + 1;
+      if (clipX1 > 240) clipX1 = 240;
+      if (clipY1 > 320) clipY1 = 320;
+      LCD_PushClip(clipX0, clipY0, clipX1 - clipX0, clipY1 - clipY0);
+    }
+    int w = 1 + rand() % 39, h = 1 + rand() % 39, scale = 1 + rand() % 4;
+    int x = rand() % 260 - 20, y = rand() % 340 - 20, kind = rand() % 3;
+    if (kind == 0) {
+      LCD_BlitScaled(x, y, w, h, src, scale);
+      ModelRGB(x, y, w, h, scale);
+    } else if (kind == 1) {
+      LCD_BlitPal4Scaled(x, y, w, h, src4, palette, scale);
+      ModelPal4(x, y, w, h, scale);
+    } else {
+      int transparent = rand() % 2;
+      uint8_t code = rand() % 4 ? 32 + rand() % 95 : rand();
+      uint16_t fg = rand(), bg = rand();
+      LCD_SetTextMode(transparent ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+      LCD_PutCharScaled(x, y, code, fg, bg, scale);
+      ModelChar(x, y, code, fg, bg, scale, transparent);
+      LCD_SetTextMode(LCD_TEXT_OPAQUE);
+    }
+    if (clip) LCD_PopClip();
+    if (!Same()) {
+      CHECK(0, "draw %d: kind %d, %dx%d x%d at (%d,%d) differs from the model", i, kind, w, h, scale, x, y);
+      break;
+    }
+  }
+  clipX0 = 0; clipY0 = 0; clipX1 = 240; clipY1 = 320;
+}
+
+// Enlarged sizes of 65536 pixels and more: 1025 x 64 wraps to 64 in 16
+// bits, 1024 x 64 to 0, and 1100 x 64 from far left to a bitmap ending
+// off-screen
+static void Large(void)
+{
+  static const struct { int x, y, w, h, scale; } cases[] = {
+    { 0, 0, 1025, 1, 64 }, { 0, 0, 1024, 1, 64 }, { 0, 0, 1, 1025, 64 },
+    { -32000, 5, 1100, 2, 64 }, { 5, -32000, 2, 1100, 64 }, { -300, -300, 257, 3, 255 },
+  };
+
+  for (unsigned i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+    int x = cases[i].x, y = cases[i].y, w = cases[i].w, h = cases[i].h, s = cases[i].scale;
+    LCD_Clear(Black);
+    memset(model, 0, sizeof model);
+    LCD_BlitScaled(x, y, w, h, src, s);
+    ModelRGB(x, y, w, h, s);
+    CHECK(Same(), "LCD_BlitScaled %dx%d x%d at (%d,%d)", w, h, s, x, y);
+
+    LCD_Clear(Black);
+    memset(model, 0, sizeof model);
+    LCD_BlitPal4Scaled(x, y, w, h, src4, palette, s);
+    ModelPal4(x, y, w, h, s);
+    CHECK(Same(), "LCD_BlitPal4Scaled %dx%d x%d at (%d,%d)", w, h, s, x, y);
+  }
+
+  for (int transparent = 0; transparent < 2; transparent++) {
+    LCD_Clear(Black);
+    memset(model, 0, sizeof model);
+    LCD_SetTextMode(transparent ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+    LCD_PutCharScaled((uint16_t)-1500, (uint16_t)-3000, 'W', White, Blue, 255);
+    ModelChar(-1500, -3000, 'W', White, Blue, 255, transparent);
+    CHECK(Same(), "LCD_PutCharScaled x255, %s", transparent ? "transparent" : "opaque");
+  }
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+}
+
+static void Sprite(void)
+{
+  const SPRITE_T *sprite = &gsUFOSprite;
+
+  for (int s = 1; s <= 3; s++) {
+    const BYTE *pixels = sprite->pbyPixels;
+
+    LCD_Clear(Black);
+    memset(model, 0, sizeof model);
+    emu_clear_counters();
+    BlitSpriteScaled(10, 20, sprite, s);
+    printf("UFO x%d: %llu stores\n", s, (unsigned long long)emu_stores());
+    for (int r = 0; r < sprite->byRunCount; r++) {
+      const SPRITE_RUN_T *run = &sprite->psRuns[r];
+      int stride = (run->byWidth + 1) / 2;
+      Model(10 + run->byX * s, 20 + run->byY * s, run->byWidth, run->byHeight, s, [&](int sx, int sy) {
+        uint8_t b = pixels[sy * stride + sx / 2];
+        return (int)sprite->pwPalette[(sx & 1) ? b & 15 : b >> 4];
+      });
+      pixels += stride * run->byHeight;
+    }
+    CHECK(Same(), "BlitSpriteScaled x%d", s);
+  }
+
+  LCD_Clear(Black);
+  for (int s = 1; s <= 4; s++) {
+    emu_clear_counters();
+    LCD_PutCharScaled(0, 0, 'A', White, Black, s);
+    printf("LCD_PutCharScaled x%d: %llu stores, %.2f a pixel\n", s,
+           (unsigned long long)emu_stores(), (double)emu_stores() / (128 * s * s));
+  }
+}
+
+int main()
+{
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  LCD_Clear(Black);
+  srand(9);
+  for (int i = 0; i < SOURCE; i++) src[i] = rand();
+  for (int i = 0; i < SOURCE / 2; i++) src4[i] = rand();
+  for (int i = 0; i < 16; i++) palette[i] = rand();
+
+  Random();
+  Large();
+  Sprite();
+  return emu_result();
+}
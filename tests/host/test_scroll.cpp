@@ -0,0 +1,76 @@
+// Render mode 5 on both controllers: the terrain is scrolled by the
+// controller and only the newly exposed lines and the sprites are drawn.
+// After every frame the visible image (GRAM read through the scroll
+// offset) must be the terrain at the camera plus every sprite; pixels and
+// stores per frame are reported.
+#include "emu.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "apUFO.c"
+
+#define FRAMES 400
+
+static uint16_t ref[320][240];
+
+// First GRAM line shown at the top of the screen
+static int VisibleLine(void)
+{
+  if (emu_ctrl == EMU_ILI9325) return (emu_reg[0x61] & 2) ? emu_reg[0x6A] % 320 : 0;
+  return emu_reg[0x41] % 320;
+}
+
+// Opaque pixels only: the terrain shows through index 0
+static void Paint(const SPRITE_T *s, int x, int y)
+{
+  const BYTE *pix = s->pbyPixels;
+
+  for (int r = 0; r < s->byRunCount; r++) {
+    const SPRITE_RUN_T *run = &s->psRuns[r];
+    int stride = (run->byWidth + 1) / 2;
+    for (int j = 0; j < run->byHeight; j++, pix += stride)
+      for (int i = 0; i < run->byWidth; i++) {
+        int v = (pix[i / 2] >> ((i & 1) ? 0 : 4)) & 15;
+        int X = x + run->byX + i, Y = y + run->byY + j;
+        if (v && X >= 0 && X < 240 && Y >= 0 && Y < 320) ref[Y][X] = s->pwPalette[v];
+      }
+  }
+}
+
+static void Run(int ctrl, const char *name)
+{
+  uint64_t px = 0, stores = 0;
+  int bad = 0;
+
+  emu_reset(ctrl);
+  InitUFOApp();
+  for (int f = 0; f < FRAMES; f++) {
+    if (f % 7 == 1) scGrenadeCallback();
+    if (f % 13 == 2) scUFOLeftCallback();
+    if (f % 17 == 3) { scUFORightCallback(); scUFORightCallback(); }
+    emu_clear_counters();
+    scRefreshLCDCallback();
+    px += emu_cnt.gram_writes;
+    stores += emu_stores();
+
+    for (int y = 0; y < 320; y++) {
+      int ground = 240 - scwTerrainHeight(scdwCameraX + y);
+      for (int x = 0; x < 240; x++) ref[y][x] = x < ground ? SKY_COLOR : GROUND_COLOR;
+    }
+    for (int i = 0; i < SPRITE_SLOTS; i++)
+      Paint(scasSlots[i].psSprite, (SWORD)scasSlots[i].wX, (SWORD)scasSlots[i].wY);
+    int v = VisibleLine();
+    for (int y = 0; y < 320; y++)
+      if (memcmp(ref[y], emu_gram[(y + v) % 320], sizeof ref[y]) && bad++ < 3)
+        CHECK(0, "%s frame %d: screen line %d differs", name, f, y);
+  }
+  printf("%s: %llu px/frame, %llu GPIO stores/frame\n", name,
+         (unsigned long long)(px / FRAMES), (unsigned long long)(stores / FRAMES));
+}
+
+int main()
+{
+  Run(EMU_SSD1289, "SSD1289");
+  Run(EMU_ILI9325, "ILI9325");
+  return emu_result();
+}
@@ -0,0 +1,102 @@
+// BlitSprite against a per-pixel reference renderer of the same SPRITE_T
+// over a patterned background, so that transparent holes must stay
+// untouched, at random positions that hang off every edge or lie wholly
+// off the screen. The span-encoded UFO and grenade must also match the
+// original nested-loop art they were generated from.
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include "gen_sprites.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t shadow[320][240], before[320][240];
+
+// One pixel at a time, clipped per pixel, straight from the run list
+static void Reference(int x, int y, const SPRITE_T *s)
+{
+  const BYTE *pix = s->pbyPixels;
+
+  for (int r = 0; r < s->byRunCount; r++) {
+    const SPRITE_RUN_T *run = &s->psRuns[r];
+    int stride = (run->byWidth + 1) / 2;
+    for (int j = 0; j < run->byHeight; j++)
+      for (int i = 0; i < run->byWidth; i++) {
+        int X = x + run->byX + i, Y = y + run->byY + j;
+        uint8_t b = pix[j * stride + i / 2];
+        if (X >= 0 && X < 240 && Y >= 0 && Y < 320)
+          shadow[Y][X] = s->pwPalette[(i & 1) ? (b & 15) : (b >> 4)];
+      }
+    pix += stride * run->byHeight;
+  }
+}
+
+static void Background(void)
+{
+  for (int y = 0; y < 320; y++)
+    for (int x = 0; x < 240; x++) shadow[y][x] = (uint16_t)((x * 31) ^ (y * 7));
+  LCD_BlitRGB565(0, 0, 240, 320, &shadow[0][0]);
+}
+
+static void Matches(const SPRITE_T *s, int x, int y, const char *what)
+{
+  Reference(x, y, s);
+  BlitSprite((WORD)x, (WORD)y, s);
+  CHECK(!memcmp(shadow, emu_gram, sizeof shadow), "%s at (%d,%d) differs", what, x, y);
+}
+
+// Box of Legacy_Display*() in display coordinates, see legacy.h
+static void SameAsLoops(const SPRITE_T *s, int gx, int gy, int x, int y, int ufo, const char *what)
+{
+  LCD_Clear(Black);
+  if (ufo) Legacy_DisplayUFO(gx, gy);
+  else Legacy_DisplayGrenade(gx, gy);
+  memcpy(before, emu_gram, sizeof before);
+  LCD_Initialization();
+  LCD_Clear(Black);
+  BlitSprite(x, y, s);
+  CHECK(!memcmp(before, emu_gram, sizeof before), "%s differs from the nested loops", what);
+}
+
+int main()
+{
+  static const struct { const SPRITE_T *s; const char *name; } sprites[] = {
+    { &gsUFOSprite, "UFO" }, { &gsGrenadeSprite, "grenade" },
+  };
+
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    emu_reset(ctrl);
+    LCD_Initialization();
+    SameAsLoops(&gsUFOSprite, 160, 24, 24 - 16, 160 - 48, 1, "UFO");
+    SameAsLoops(&gsGrenadeSprite, 100, 120, 120 - 8, 100 - 8, 0, "grenade");
+
+    for (int k = 0; k < 2; k++) {
+      const SPRITE_T *s = sprites[k].s;
+      int w = s->wWidth, h = s->wHeight;
+      static const int edges[][2] = {
+        { 0, 0 }, { -1, -1 }, { 240 - 1, 320 - 1 }, { -1000, 50 }, { 50, 1000 },
+      };
+
+      Background();
+      for (unsigned e = 0; e < sizeof edges / sizeof edges[0]; e++)
+        Matches(s, edges[e][0] == -1 ? -w + 1 : edges[e][0], edges[e][1] == -1 ? -h + 1 : edges[e][1],
+                sprites[k].name);
+      Matches(s, -w, 10, sprites[k].name);          // just off the left edge
+      Matches(s, 240, 10, sprites[k].name);         // just off the right edge
+      Matches(s, 10, -h, sprites[k].name);
+      Matches(s, 10, 320, sprites[k].name);
+
+      srand(8 + k);
+      for (int t = 0; t < 1000; t++) {
+        if (t % 100 == 0) Background();
+        Matches(s, rand() % (240 + 2 * w) - w - 4, rand() % (320 + 2 * h) - h - 4, sprites[k].name);
+      }
+      emu_clear_counters();
+      BlitSprite(60, 100, s);
+      printf("%s %-8s %2u windows, %6llu stores\n", ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325",
+             sprites[k].name, s->byRunCount, (unsigned long long)emu_stores());
+    }
+  }
+  return emu_result();
+}
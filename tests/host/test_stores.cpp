@@ -0,0 +1,71 @@
+// GPIO stores per pixel before and after the write-session API: the vendor
+// SetPoint loop, LCD_Clear and LCD_PutChar against the session-based
+// versions, each checked to leave the same GRAM.
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include <stdio.h>
+#include <string.h>
+
+static uint16_t before[320][240];
+static uint16_t pixels[64 * 48];
+
+static void Fresh(int ctrl)
+{
+  emu_reset(ctrl);
+  LCD_Initialization();
+  emu_clear_counters();
+}
+
+static double PerPixel(void)
+{
+  return (double)emu_stores() / (double)emu_cnt.gram_writes;
+}
+
+static void Compare(int ctrl, const char *what, double old_px, double new_px)
+{
+  printf("%s %-10s %7.2f -> %5.2f stores/px\n", ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325",
+         what, old_px, new_px);
+  CHECK(!memcmp(before, emu_gram, sizeof before), "%s differs", what);
+  CHECK(new_px < old_px, "%s got no cheaper", what);
+}
+
+int main()
+{
+  for (int i = 0; i < 64 * 48; i++) pixels[i] = (uint16_t)(i * 40503u);
+
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    double o, n;
+
+    Fresh(ctrl);
+    Legacy_Clear(Blue);
+    o = PerPixel();
+    memcpy(before, emu_gram, sizeof before);
+    Fresh(ctrl);
+    LCD_Clear(Blue);
+    n = PerPixel();
+    Compare(ctrl, "clear", o, n);
+
+    Fresh(ctrl);
+    for (int y = 0; y < 48; y++)
+      for (int x = 0; x < 64; x++) Legacy_SetPoint(30 + x, 40 + y, pixels[y * 64 + x]);
+    o = PerPixel();
+    memcpy(before, emu_gram, sizeof before);
+    Fresh(ctrl);
+    LCD_BeginWrite(30, 40, 64, 48);
+    LCD_WritePixels(pixels, 64 * 48);
+    LCD_EndWrite();
+    n = PerPixel();
+    Compare(ctrl, "image", o, n);
+
+    Fresh(ctrl);
+    for (int c = 0; c < 20; c++) Legacy_PutChar(8 * c, 100, 'A' + c, White, Black);
+    o = PerPixel();
+    memcpy(before, emu_gram, sizeof before);
+    Fresh(ctrl);
+    for (int c = 0; c < 20; c++) LCD_PutChar(8 * c, 100, 'A' + c, White, Black);
+    n = PerPixel();
+    Compare(ctrl, "chars", o, n);
+  }
+  return emu_result();
+}
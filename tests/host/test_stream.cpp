@@ -0,0 +1,50 @@
+// Stores per streamed pixel, measured on the bus mock rather than stated
+// in a header: each streaming primitive is run at two sizes and the
+// difference, which excludes the window and session setup, must come to
+// at most LCD_WriteStream's five GPIO stores a pixel.
+#include "emu.h"
+#include "GLCD.h"
+#include <stdio.h>
+
+#define STREAM_STORES 5
+
+static uint16_t rgb[240 * 100];
+static uint8_t pal4[240 * 100 / 2];
+static uint16_t palette[16];
+
+static uint64_t Cost(int which, uint16_t rows)
+{
+  emu_clear_counters();
+  switch (which) {
+    case 0: LCD_FillRect(0, 10, 240, rows, Red); break;
+    case 1: LCD_BeginWrite(0, 10, 240, rows); LCD_WritePixels(rgb, 240u * rows); LCD_EndWrite(); break;
+    case 2: LCD_BeginWrite(0, 10, 240, rows); LCD_WriteRepeat(Green, 240u * rows); LCD_EndWrite(); break;
+    case 3: LCD_BlitRGB565(0, 10, 240, rows, rgb); break;
+    case 4: LCD_BlitPal4(0, 10, 240, rows, pal4, palette); break;
+    case 5:
+      if (LCD_BeginWriteColumns(0, 10, rows, 240)) { LCD_WritePixels(rgb, 240u * rows); LCD_EndWrite(); }
+      break;
+  }
+  return emu_stores();
+}
+
+int main()
+{
+  static const char *const names[] = { "FillRect", "WritePixels", "WriteRepeat",
+                                       "BlitRGB565", "BlitPal4", "column session" };
+  for (int i = 0; i < 240 * 100; i++) rgb[i] = (uint16_t)(i * 7919u);
+  for (int i = 0; i < 240 * 100 / 2; i++) pal4[i] = (uint8_t)(i * 37u);
+  for (int i = 0; i < 16; i++) palette[i] = (uint16_t)(i * 0x1111u);
+
+  for (int ctrl = EMU_SSD1289; ctrl <= EMU_ILI9325; ctrl++) {
+    emu_reset(ctrl);
+    LCD_Initialization();
+    for (int w = 0; w < 6; w++) {
+      uint64_t small = Cost(w, 50), large = Cost(w, 100);
+      double per = (double)(large - small) / (240.0 * 50);
+      printf("%s %-15s %.3f stores/px\n", ctrl == EMU_SSD1289 ? "SSD1289" : "ILI9325", names[w], per);
+      CHECK(per <= STREAM_STORES, "%s streams at %.3f stores/px", names[w], per);
+    }
+  }
+  return emu_result();
+}
@@ -0,0 +1,131 @@
+// LCD_PutChar and LCD_PutText with the AsciiLib font against a per-pixel
+// model, opaque and transparent, wrapping and clipped. Then glyph
+// throughput: stores per glyph and glyphs per second of virtual bus time
+// for the vendor per-pixel PutChar, LCD_PutChar, and LCD_PutText, which
+// sends a line of glyphs through LCD_PutGlyphs as one burst.
+#include "emu.h"
+#include "legacy.h"
+#include "GLCD.h"
+#include "AsciiLib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t model[320][240];
+static int clipX0, clipY0, clipX1, clipY1;
+
+static void Plot(int x, int y, uint16_t c)
+{
+  if (x >= clipX0 && x < clipX1 && y >= clipY0 && y < clipY1) model[y][x] = c;
+}
+
+static void ModelChar(int x, int y, uint8_t code, uint16_t fg, uint16_t bg, int transparent)
+{
+  uint8_t glyph[16];
+
+  GetASCIICode(glyph, code);
+  for (int r = 0; r < 16; r++)
+    for (int c = 0; c < 8; c++) {
+      if ((glyph[r] >> (7 - c)) & 1) Plot(x + c, y + r, fg);
+      else if (!transparent) Plot(x + c, y + r, bg);
+    }
+}
+
+// LCD_PutText wraps at the right edge and back to the top at the bottom
+static void ModelText(int x, int y, const uint8_t *s, uint16_t fg, uint16_t bg, int transparent)
+{
+  for (; *s; s++) {
+    ModelChar(x, y, *s, fg, bg, transparent);
+    if (x < 240 - 8) x += 8;
+    else if (y < 320 - 16) { x = 0; y += 16; }
+    else { x = 0; y = 0; }
+  }
+}
+
+static void Differential(void)
+{
+  int bad = 0;
+
+  LCD_Clear(Black);
+  memset(model, 0, sizeof model);
+  srand(5);
+  for (int i = 0; i < 400 && !bad; i++) {
+    int transparent = rand() & 1, clip = rand() % 3 == 0, n = rand() % 50;
+    uint8_t s[60];
+
+    LCD_SetTextMode(transparent ? LCD_TEXT_TRANSPARENT : LCD_TEXT_OPAQUE);
+    clipX0 = 0; clipY0 = 0; clipX1 = 240; clipY1 = 320;
+    if (clip) {
+      clipX0 = rand() % 200; clipY0 = rand() % 280;
+      clipX1 = clipX0 + rand() % 40 + 1; clipY1 = clipY0 + rand() % 40 + 1;
+      LCD_PushClip(clipX0, clipY0, clipX1 - clipX0, clipY1 - clipY0);
+    }
+    // Codes without a glyph included
+    for (int k = 0; k < n; k++) s[k] = rand() % 4 == 0 ? 1 + rand() % 255 : 32 + rand() % 95;
+    s[n] = 0;
+    int x = rand() % 245, y = rand() % 325;
+    uint16_t fg = rand(), bg = rand();
+    if (rand() % 4 == 0 && n) {
+      LCD_PutChar(x, y, s[0], fg, bg);
+      ModelChar(x, y, s[0], fg, bg, transparent);
+    } else {
+      LCD_PutText(x, y, s, fg, bg);
+      ModelText(x, y, s, fg, bg, transparent);
+    }
+    if (clip) LCD_PopClip();
+    if (memcmp(model, emu_gram, sizeof model)) {
+      CHECK(0, "text %d at (%d,%d), %s%s, differs from the model", i, x, y,
+            transparent ? "transparent" : "opaque", clip ? ", clipped" : "");
+      bad = 1;
+    }
+  }
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+}
+
+static void Report(const char *tag, int glyphs, uint64_t ns)
+{
+  printf("%-30s %6.1f stores/glyph %8.0f glyphs/s\n", tag, (double)emu_stores() / glyphs, glyphs * 1e9 / ns);
+}
+
+int main()
+{
+  static uint8_t line[31];
+  uint64_t ns;
+
+  for (int i = 0; i < 30; i++) line[i] = 'A' + i % 26;
+
+  // The vendor PutChar bypasses the cursor model, so first and alone
+  emu_reset(EMU_ILI9325);
+  LCD_Initialization();
+  emu_clear_counters();
+  ns = emu_ns;
+  for (int y = 0; y < 20; y++)
+    for (int x = 0; x < 30; x++) Legacy_PutChar(x * 8, y * 16, line[x], White, Black);
+  Report("vendor PutChar", 600, emu_ns - ns);
+
+  emu_reset(EMU_ILI9325);
+  LCD_Initialization();
+  emu_clear_counters();
+  ns = emu_ns;
+  for (int y = 0; y < 20; y++)
+    for (int x = 0; x < 30; x++) LCD_PutChar(x * 8, y * 16, line[x], White, Black);
+  Report("LCD_PutChar", 600, emu_ns - ns);
+
+  emu_clear_counters();
+  ns = emu_ns;
+  for (int y = 0; y < 20; y++) LCD_PutText(0, y * 16, line, White, Black);
+  Report("LCD_PutText, 30 a line", 600, emu_ns - ns);
+
+  LCD_Clear(Black);
+  LCD_SetTextMode(LCD_TEXT_TRANSPARENT);
+  emu_clear_counters();
+  ns = emu_ns;
+  for (int y = 0; y < 20; y++) LCD_PutText(0, y * 16, line, White, Black);
+  Report("LCD_PutText, transparent", 600, emu_ns - ns);
+  LCD_SetTextMode(LCD_TEXT_OPAQUE);
+
+  emu_reset(EMU_SSD1289);
+  LCD_Initialization();
+  Differential();
+  return emu_result();
+}
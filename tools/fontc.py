@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+"""Font compiler for the GLCD font blob.
+
+Usage: python tools/fontc.py <fonts.txt> <output base name>
+
+Reads the font definitions (see fonts.txt for the format) and writes
+<base>.h and <base>.c holding one blob with every font, in the layout
+LCD_SetFont reads:
+
+  directory  font count, then the offset of each font
+  font       height, first code, last code, foreground run bits, then the
+             offset of each glyph and one past the last, from the font start
+  glyph      advance width, then the pixels column by column, top to
+             bottom, as bytes of a background run (high bits) followed by
+             a foreground run (low bits)
+
+Offsets are 16-bit little endian. Glyphs are made proportional: blank
+columns at both sides are trimmed and one blank column is kept for the
+spacing; blank glyphs get the font's space width. Each font gets the run
+split that encodes it in the fewest bytes.
+
+Fonts marked "aa" are anti-aliased instead: the 1-bit source is smoothed
+with Scale2x twice, resized by the given ratio and box filtered down to
+4-bit coverage. Their foreground run bits are 0 and each glyph byte is a
+run of equal coverage: the alpha (high nibble, 15 = solid) and the run
+length minus one (low nibble).
+"""
+
+import os
+import re
+import sys
+
+
+class FontError(Exception):
+    pass
+
+
+def parse(path):
+    fonts = []       # (name, height, space, {code: columns}, aa ratio or None)
+    current = None
+    base = os.path.dirname(path)
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            words = line.split()
+            if not words or words[0].startswith('#'):
+                continue
+            if current is not None:
+                if words == ['end']:
+                    fonts.append(current + (aa,))
+                    current = None
+                else:
+                    try:
+                        current[3][int(words[0], 16)] = [int(w, 16) for w in words[1:]]
+                    except ValueError:
+                        raise FontError('%s:%d: cannot parse "%s"' % (path, number, line.strip()))
+                continue
+            aa = None
+            if len(words) == 8 and words[6] == 'aa':
+                aa = ratio(words[7])
+                if aa is None:
+                    raise FontError('%s:%d: bad ratio "%s"' % (path, number, words[7]))
+                words = words[:6]
+            if (len(words) == 6 and words[0] == 'font' and words[2] == 'columns'
+                    and words[4] == 'space'):
+                current = (words[1], int(words[3]), int(words[5]), {})
+            elif (len(words) == 6 and words[0] == 'font' and words[2] == 'asciilib'
+                  and words[4] == 'space'):
+                fonts.append((words[1], 16, int(words[5]),
+                              asciilib(os.path.join(base, words[3])), aa))
+            else:
+                raise FontError('%s:%d: cannot parse "%s"' % (path, number, line.strip()))
+    if current is not None:
+        raise FontError('%s: font %s has no end' % (path, current[0]))
+    if len(fonts) > 255:
+        raise FontError('%s: too many fonts' % path)
+    return fonts
+
+
+def ratio(text):
+    match = re.match(r'^([1-9][0-9]*)/([1-9][0-9]*)$', text)
+    return (int(match.group(1)), int(match.group(2))) if match else None
+
+
+def asciilib(path):
+    """Columns of the 8x16 AsciiLib table, rows stored MSB on the left."""
+    with open(path, encoding='latin-1') as f:
+        rows = re.findall(r'\{((?:0x[0-9A-Fa-f]{2},?){16})\}', f.read())
+    if len(rows) != 95:
+        raise FontError('%s: expected 95 glyphs, found %d' % (path, len(rows)))
+    glyphs = {}
+    for code, row in enumerate(rows, 32):
+        data = [int(b, 16) for b in row.split(',') if b]
+        glyphs[code] = [sum(((data[y] >> (7 - x)) & 1) << y for y in range(16))
+                        for x in range(8)]
+    return glyphs
+
+
+def proportional(columns, space):
+    used = [i for i, c in enumerate(columns) if c]
+    if not used:
+        return [0] * space
+    return columns[used[0]:used[-1] + 1] + [0]
+
+
+def scale2x(image):
+    """Doubles a 0/1 image, rounding off the corners of diagonal edges."""
+    height, width = len(image), len(image[0])
+
+    def at(x, y):
+        return image[y][x] if 0 <= x < width and 0 <= y < height else 0
+
+    result = [[0] * (2 * width) for _ in range(2 * height)]
+    for y in range(height):
+        for x in range(width):
+            p, a, b, c, d = at(x, y), at(x, y - 1), at(x + 1, y), at(x - 1, y), at(x, y + 1)
+            result[2 * y][2 * x] = a if c == a and c != d and a != b else p
+            result[2 * y][2 * x + 1] = b if a == b and a != c and b != d else p
+            result[2 * y + 1][2 * x] = c if d == c and d != b and c != a else p
+            result[2 * y + 1][2 * x + 1] = d if b == d and b != a and d != c else p
+    return result
+
+
+def antialias(columns, height, aa):
+    """Coverage columns, 0..15 per pixel, of a glyph resized by aa."""
+    num, den = aa
+    width = len(columns)
+    image = [[(columns[x] >> y) & 1 for x in range(width)] for y in range(height)]
+    image = scale2x(scale2x(image))
+    # Every smoothed pixel becomes num x num samples; every output pixel
+    # averages 4 * den x 4 * den samples
+    box = 4 * den
+    out_w, out_h = -(-width * num // den), -(-height * num // den)
+    result = []
+    for ox in range(out_w):
+        column = []
+        for oy in range(out_h):
+            total = 0
+            for sy in range(oy * box, (oy + 1) * box):
+                row = image[sy // num] if sy // num < 4 * height else None
+                for sx in range(ox * box, (ox + 1) * box):
+                    if row is not None and sx // num < 4 * width:
+                        total += row[sx // num]
+            column.append((total * 15 + box * box // 2) // (box * box))
+        result.append(column)
+    return result
+
+
+def alpha_proportional(columns, height, space):
+    used = [i for i, c in enumerate(columns) if any(c)]
+    if not used:
+        return [[0] * height for _ in range(space)]
+    return columns[used[0]:used[-1] + 1] + [[0] * height]
+
+
+def alpha_encode(columns):
+    data, value, length = [], None, 0
+    for alpha in [a for column in columns for a in column]:
+        if alpha != value or length == 16:
+            if length:
+                data.append((value << 4) | (length - 1))
+            value, length = alpha, 0
+        length += 1
+    data.append((value << 4) | (length - 1))
+    return data
+
+
+def runs(columns, height):
+    """Alternating background/foreground run lengths, background first."""
+    result, value, length = [], 0, 0
+    for column in columns:
+        for y in range(height):
+            bit = (column >> y) & 1
+            if bit != value:
+                result.append(length)
+                value, length = bit, 0
+            length += 1
+    result.append(length)
+    if len(result) % 2:
+        result.append(0)
+    return result
+
+
+def encode(pairs, fg_bits):
+    max_bg, max_fg = (1 << (8 - fg_bits)) - 1, (1 << fg_bits) - 1
+    data = []
+    for i in range(0, len(pairs), 2):
+        bg, fg = pairs[i], pairs[i + 1]
+        while bg > max_bg:
+            data.append(max_bg << fg_bits)
+            bg -= max_bg
+        while fg > max_fg:
+            data.append((bg << fg_bits) | max_fg)
+            bg, fg = 0, fg - max_fg
+        if bg or fg or not data:
+            data.append((bg << fg_bits) | fg)
+    return data
+
+
+def compile_font(name, height, space, glyphs, aa):
+    first, last = min(glyphs), max(glyphs)
+    for code in range(first, last + 1):
+        if code not in glyphs:
+            raise FontError('font %s: no glyph for 0x%02X' % (name, code))
+        if any(c >> height for c in glyphs[code]):
+            raise FontError('font %s: glyph 0x%02X is taller than %d' % (name, code, height))
+    if aa:
+        source = height
+        height = -(-source * aa[0] // aa[1])
+    if not 1 <= height <= 255:
+        raise FontError('font %s: height must be 1..255' % name)
+    if aa:
+        columns = dict((c, alpha_proportional(antialias(glyphs[c], source, aa), height, space))
+                       for c in glyphs)
+        fg_bits = 0
+        encoded = dict((c, alpha_encode(columns[c])) for c in glyphs)
+    else:
+        columns = dict((c, proportional(glyphs[c], space)) for c in glyphs)
+        pixel_runs = dict((c, runs(columns[c], height)) for c in glyphs)
+        best = None
+        for fg_bits in range(1, 8):
+            size = sum(len(encode(pixel_runs[c], fg_bits)) for c in glyphs)
+            if best is None or size < best[1]:
+                best = (fg_bits, size)
+        fg_bits = best[0]
+        encoded = dict((c, encode(pixel_runs[c], fg_bits)) for c in glyphs)
+
+    index_size = 4 + 2 * (last - first + 2)
+    body, offsets, comments = [], [], []
+    for code in range(first, last + 1):
+        offsets.append(index_size + len(body))
+        glyph = [len(columns[code])] + encoded[code]
+        comments.append((len(body), code, glyph))
+        body += glyph
+    offsets.append(index_size + len(body))
+    if offsets[-1] > 0xFFFF:
+        raise FontError('font %s: larger than 64KB' % name)
+    header = [height, first, last, fg_bits]
+    for offset in offsets:
+        header += [offset & 0xFF, offset >> 8]
+    return height, header, comments, header + body
+
+
+def char_name(code):
+    return "'%s'" % chr(code)
+
+
+def generate(src, base):
+    fonts = parse(src)
+    header = os.path.basename(base) + '.h'
+    guard = '__%s_H__' % os.path.basename(base).upper()
+    banner = ('/* Generated by tools/fontc.py from %s - do not edit */\n'
+              % os.path.basename(src))
+
+    compiled = [compile_font(*font) for font in fonts]
+    directory = [len(fonts)]
+    offset = 1 + 2 * len(fonts)
+    for _, _, _, data in compiled:
+        directory += [offset & 0xFF, offset >> 8]
+        offset += len(data)
+
+    def hex_lines(data, indent='    '):
+        return [indent + ', '.join('0x%02X' % b for b in data[i:i + 12]) + ','
+                for i in range(0, len(data), 12)]
+
+    c = [banner, '/* -- INCLUDES -- */', '#include "%s"' % header, '',
+         '/* -- STATIC AND GLOBAL VARIABLES -- */',
+         '/* Layout in tools/fontc.py; read by LCD_SetFont */',
+         'const BYTE gabyFontBlob[FONT_BLOB_SIZE] =', '{',
+         '    /* directory */'] + hex_lines(directory)
+    for font, (height, head, comments, data) in zip(fonts, compiled):
+        c += ['', '    /* %s: %d high%s, %d bytes */'
+              % (font[0], height, ', anti-aliased' if font[4] else '', len(data))]
+        c += hex_lines(head)
+        for _, code, glyph in comments:
+            c.append('    /* %s */' % char_name(code))
+            c += hex_lines(glyph)
+    c += ['};']
+
+    h = [banner, '#ifndef %s' % guard, '#define %s' % guard, '',
+         '/* -- INCLUDES -- */', '#include "bspDataTypes.h"', '',
+         '/* -- DEFINES and ENUMS -- */',
+         '/* Font numbers for LCD_SetFont */']
+    for number, (font, (height, _, _, _)) in enumerate(zip(fonts, compiled)):
+        h.append('#define %-24s%d   /* %d pixels high%s */'
+                 % ('FONT_' + font[0].upper(), number, height, ', anti-aliased' if font[4] else ''))
+    h += ['', '#define %-24s%d' % ('FONT_BLOB_SIZE', offset), '',
+          '/* -- GLOBAL VARIABLES -- */',
+          'extern const BYTE gabyFontBlob[FONT_BLOB_SIZE];', '',
+          '#endif /* %s */' % guard]
+
+    with open(base + '.h', 'w') as f:
+        f.write('\n'.join(h) + '\n')
+    with open(base + '.c', 'w') as f:
+        f.write('\n'.join(c) + '\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    try:
+        generate(sys.argv[1], sys.argv[2])
+    except FontError as e:
+        sys.exit('fontc: %s' % e)
@@ -0,0 +1,231 @@
+#!/usr/bin/env python3
+"""Sprite compiler for apUFO.c.
+
+Usage: python tools/spritec.py <sprites.txt> <output base name>
+
+Reads the ASCII-art sprite definitions (see sprites.txt for the format) and
+writes <base>.h and <base>.c. For every sprite the output holds:
+
+  - a SPRITE_T table for the generic BlitSprite path, which clips, and
+  - a compiled DrawXxxSprite(wX, wY) function made only of the window
+    setups and color runs that sprite needs. It does no clipping, so the
+    sprite must lie entirely on the display, and
+  - a cell map with one tile index per scale x scale block, for the tile
+    map. The output also holds a tile set with one solid tile per color,
+    tile 0 being the background.
+
+Sprites are defined in landscape orientation and emitted in display
+orientation (each display row is one landscape column), as the app swaps
+X and Y when it draws.
+"""
+
+import os
+import sys
+
+
+class SpriteError(Exception):
+    pass
+
+
+def parse(path):
+    colors = []      # (char, value) in declaration order
+    sprites = []     # (name, scale, rows)
+    current = None
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            text = line.rstrip('\n')
+            if current is not None:
+                if text.strip() == 'end':
+                    sprites.append(current)
+                    current = None
+                else:
+                    current[2].append(text.rstrip())
+                continue
+            words = text.split()
+            if not words or words[0].startswith('#'):
+                continue
+            if words[0] == 'color' and len(words) == 3 and len(words[1]) == 1:
+                colors.append((words[1], words[2]))
+            elif words[0] == 'sprite' and len(words) == 4 and words[2] == 'scale':
+                current = (words[1], int(words[3]), [])
+            else:
+                raise SpriteError('%s:%d: cannot parse "%s"' % (path, number, text))
+    if current is not None:
+        raise SpriteError('%s: sprite %s has no end' % (path, current[0]))
+    if len(colors) > 15:
+        raise SpriteError('%s: at most 15 colors fit a 4-bit palette' % path)
+    return colors, sprites
+
+
+def rasterize(name, scale, rows, index):
+    """Return display-orientation pixels: pixels[y][x], 0 = transparent."""
+    width = max(len(r) for r in rows)
+    cells = []
+    for r in rows:
+        line = []
+        for c in r.ljust(width, '.'):
+            if c != '.' and c not in index:
+                raise SpriteError('sprite %s: undeclared color "%s"' % (name, c))
+            line.append(0 if c == '.' else index[c])
+        cells.append(line)
+    # display row = landscape column, display column = landscape row
+    return [[cells[x // scale][y // scale] for x in range(len(rows) * scale)]
+            for y in range(width * scale)]
+
+
+def opaque_spans(row):
+    spans, x = [], 0
+    while x < len(row):
+        if row[x]:
+            start = x
+            while x < len(row) and row[x]:
+                x += 1
+            spans.append((start, x - start))
+        else:
+            x += 1
+    return spans
+
+
+def windows(pixels):
+    """Group rows with identical opaque spans into one window per span."""
+    result, y = [], 0
+    while y < len(pixels):
+        spans, start = opaque_spans(pixels[y]), y
+        while y < len(pixels) and opaque_spans(pixels[y]) == spans:
+            y += 1
+        for x, w in spans:
+            result.append((x, start, w, y - start,
+                           [pixels[r][x:x + w] for r in range(start, y)]))
+    return result
+
+
+def pack4(rows):
+    data = []
+    for row in rows:
+        padded = row + [0] * (len(row) & 1)
+        data += [(padded[i] << 4) | padded[i + 1] for i in range(0, len(padded), 2)]
+    return data
+
+
+def color_runs(rows):
+    runs = []
+    for value in (p for row in rows for p in row):
+        if runs and runs[-1][0] == value:
+            runs[-1][1] += 1
+        else:
+            runs.append([value, 1])
+    return runs
+
+
+def generate(src, base):
+    colors, sprites = parse(src)
+    index = dict((c, i + 1) for i, (c, _) in enumerate(colors))
+    names = [v for _, v in colors]
+    guard = '__%s_H__' % os.path.basename(base).upper()
+    header = os.path.basename(base) + '.h'
+    banner = ('/* Generated by tools/spritec.py from %s - do not edit */\n'
+              % os.path.basename(src))
+
+    h = [banner, '#ifndef %s' % guard, '#define %s' % guard, '',
+         '/* -- INCLUDES -- */', '#include "bspHardwareAbstractionLayer.h"',
+         '#include "bspTileMap.h"', '',
+         '/* -- DEFINES and ENUMS -- */',
+         '/* Sprite bounding boxes in display orientation, cell maps in landscape */']
+    c = [banner, '/* -- INCLUDES -- */', '#include "GLCD.h"',
+         '#include "%s"' % header, '',
+         '/* -- STATIC AND GLOBAL VARIABLES -- */',
+         '/* Shared palette; index 0 is transparent in sprites and the background tile */',
+         'static const WORD scawSpritePalette[16] =', '{',
+         '    0x0000, %s' % ', '.join(names), '};', '',
+         '/* Solid tiles, one per palette color */',
+         'static const BYTE scabySpriteTiles[%d * TILE_BYTES] =' % (len(names) + 1), '{']
+    for i in range(len(names) + 1):
+        c.append('    /* %s */' % ('background' if i == 0 else names[i - 1]))
+        for _ in range(0, 32, 16):
+            c.append('    ' + ', '.join(['0x%X%X' % (i, i)] * 16) + ',')
+    c += ['};', '', 'const TILE_SET_T gsSpriteTileSet =', '{',
+          '    scabySpriteTiles, scawSpritePalette', '};']
+    decls = ['extern const TILE_SET_T gsSpriteTileSet;']
+
+    for name, scale, rows in sprites:
+        pixels = rasterize(name, scale, rows, index)
+        wins = windows(pixels)
+        height, width = len(pixels), len(pixels[0])
+        for x, y, w, hh, _ in wins:
+            if max(x, y, w, hh) > 255:
+                raise SpriteError('sprite %s: window does not fit SPRITE_RUN_T' % name)
+        macro = name.upper()
+        h.append('#define %-24s%d' % (macro + '_SPRITE_WIDTH', width))
+        h.append('#define %-24s%d' % (macro + '_SPRITE_HEIGHT', height))
+        h.append('#define %-24s%d' % (macro + '_CELL_COLUMNS', max(len(r) for r in rows)))
+        h.append('#define %-24s%d' % (macro + '_CELL_ROWS', len(rows)))
+        decls += ['extern const SPRITE_T gs%sSprite;' % name,
+                  'extern const BYTE gaby%sCells[];' % name,
+                  'extern void Draw%sSprite(WORD wX, WORD wY);' % name]
+
+        c += ['', 'static const SPRITE_RUN_T scas%sRuns[] =' % name, '{']
+        c += ['    { %3d, %3d, %3d, %3d },' % (x, y, w, hh) for x, y, w, hh, _ in wins]
+        c += ['};', '', 'static const BYTE scaby%sPixels[] =' % name, '{']
+        for x, y, w, hh, rows_ in wins:
+            data = pack4(rows_)
+            c.append('    /* %dx%d at %d,%d */' % (w, hh, x, y))
+            for i in range(0, len(data), 12):
+                c.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 12]) + ',')
+        c += ['};', '',
+              'const SPRITE_T gs%sSprite =' % name, '{',
+              '    %d, %d,' % (width, height),
+              '    %d, scas%sRuns,' % (len(wins), name),
+              '    scaby%sPixels, scawSpritePalette' % name, '};', '',
+              '/* Landscape orientation, row by row, 0 is transparent */',
+              'const BYTE gaby%sCells[%s_CELL_ROWS * %s_CELL_COLUMNS] =' % (name, macro, macro), '{']
+        width_cells = max(len(r) for r in rows)
+        for r in rows:
+            c.append('    ' + ', '.join('%d' % (0 if ch == '.' else index[ch])
+                                        for ch in r.ljust(width_cells, '.')) + ',')
+        c.append('};')
+
+    c += ['', '']
+    for name, scale, rows in sprites:
+        wins = windows(rasterize(name, scale, rows, index))
+        c += ['/*----------------------------------------------------------------------------',
+              '',
+              '    @Prototype: void Draw%sSprite(WORD wX, WORD wY)' % name,
+              '',
+              '    @Description: Compiled %s sprite: draws its opaque windows with no' % name,
+              '                  clipping, so the sprite must lie entirely on the display.',
+              '',
+              '    @Parameters: WORD wX - Top-left row coordinate of the bounding box',
+              '                 WORD wY - Top-left line coordinate of the bounding box',
+              '',
+              '    @Returns: void',
+              '',
+              ' *----------------------------------------------------------------------------*/',
+              'void Draw%sSprite(WORD wX, WORD wY)' % name, '{']
+        for n, (x, y, w, hh, rows_) in enumerate(wins):
+            if n:
+                c.append('')
+            c.append('    LCD_BeginWrite(wX + %d, wY + %d, %d, %d);' % (x, y, w, hh))
+            for value, count in color_runs(rows_):
+                c.append('    LCD_WriteRepeat(%s, %d);' % (names[value - 1], count))
+            c.append('    LCD_EndWrite();')
+        c += ['}', '', '']
+
+    h += ['', '/* -- GLOBAL VARIABLES -- */'] + [d for d in decls if 'Draw' not in d]
+    h += ['', '/* -- EXTERNAL FUNCTIONS -- */'] + [d for d in decls if 'Draw' in d]
+    h += ['', '#endif /* %s */' % guard]
+
+    while c[-1] == '':
+        c.pop()
+    with open(base + '.h', 'w') as f:
+        f.write('\n'.join(h) + '\n')
+    with open(base + '.c', 'w') as f:
+        f.write('\n'.join(c) + '\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    try:
+        generate(sys.argv[1], sys.argv[2])
+    except SpriteError as e:
+        sys.exit('spritec: %s' % e)